@@ -15,10 +15,9 @@ COMPRESSION_CODECS = [
     "NONE",
     "SNAPPY",
     "GZIP",
-    # Brotli is currently not supported by duckdb
+    # Brotli is not supported by duckdb
     "BROTLI",
-    # This generates the new LZ4_RAW parquet compression, which duckdb does not
-    # support
+    # This generates the new LZ4_RAW parquet compression
     "LZ4",
     "ZSTD",
 ]
@@ -89,3 +88,29 @@ for compression, data_page_version in itertools.product(COMPRESSION_CODECS, DATA
         ])).with_suffix(".parquet"),
         **pq_args
     )
+
+
+def build_lz4_patterns_table():
+    """Strings that exercise the LZ4 format: incompressible values, long
+    matches with an offset of a single byte and repeated 32 byte sequences.
+    The values can be reproduced in SQL to compare against."""
+    import hashlib
+    N = 2000
+    i = list(range(N))
+    return pa.Table.from_pydict({
+        "i": pa.array(i, pa.int64()),
+        "h": [hashlib.md5(str(x).encode()).hexdigest() for x in i],
+        "r": [chr(97 + x % 26) * (x % 300) for x in i],
+        "p": [hashlib.md5(str(x % 7).encode()).hexdigest() * (x % 5) for x in i],
+    })
+
+
+# Pages compressed by the reference LZ4 implementation, to check that our LZ4
+# codec reads them
+pq.write_table(
+    build_lz4_patterns_table(),
+    root / "lz4_raw_patterns.parquet",
+    compression="LZ4",
+    use_dictionary=False,
+    row_group_size=2000,
+)
@@ -0,0 +1,184 @@
+#include "http_disk_cache.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+HTTPDiskCache::HTTPDiskCache(string directory_p, idx_t max_size_p)
+    : directory(std::move(directory_p)), max_size(max_size_p), fs(FileSystem::CreateLocal()), total_size(0),
+      temp_file_count(0) {
+	if (!fs->DirectoryExists(directory)) {
+		fs->CreateDirectory(directory);
+	}
+	// pick up the blocks that were cached by earlier runs, and clean up writes that never finished
+	// temporary files that were modified recently may still be written by another process that uses the directory
+	vector<string> block_names;
+	vector<string> temp_files;
+	fs->ListFiles(directory, [&](const string &name, bool is_dir) {
+		if (is_dir) {
+			return;
+		}
+		if (StringUtil::EndsWith(name, ".block")) {
+			block_names.push_back(name);
+		} else if (StringUtil::EndsWith(name, ".tmp")) {
+			temp_files.push_back(name);
+		}
+	});
+	auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	for (auto &name : temp_files) {
+		try {
+			auto temp_path = GetBlockPath(name);
+			time_t last_modified;
+			{
+				auto handle = fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_READ);
+				last_modified = fs->GetLastModifiedTime(*handle);
+			}
+			if (now - last_modified < STALE_TEMP_FILE_AGE) {
+				continue;
+			}
+			fs->RemoveFile(temp_path);
+		} catch (std::exception &ex) { // NOLINT
+		}
+	}
+	lock_guard<mutex> guard(lock);
+	for (auto &name : block_names) {
+		try {
+			auto handle = fs->OpenFile(GetBlockPath(name), FileFlags::FILE_FLAGS_READ);
+			AddBlock(name, fs->GetFileSize(*handle));
+		} catch (std::exception &ex) { // NOLINT
+		}
+	}
+	EvictBlocks();
+}
+
+string HTTPDiskCache::GetFileKey(const string &url, const string &etag, time_t last_modified, idx_t length) {
+	if (etag.empty() && last_modified == 0) {
+		// we cannot tell if the remote file changes
+		return string();
+	}
+	return url + "\n" + etag + "\n" + to_string(last_modified) + "\n" + to_string(length);
+}
+
+string HTTPDiskCache::GetBlockPath(const string &block_name) {
+	return fs->JoinPath(directory, block_name);
+}
+
+string HTTPDiskCache::GetBlockName(const string &key, idx_t block_idx) {
+	// the key itself is stored in the block as well, so hash collisions are detected when reading
+	return to_string(Hash(key.c_str(), key.size())) + "_" + to_string(block_idx) + ".block";
+}
+
+void HTTPDiskCache::SetMaxSize(idx_t max_size_p) {
+	lock_guard<mutex> guard(lock);
+	max_size = max_size_p;
+	EvictBlocks();
+}
+
+bool HTTPDiskCache::Contains(const string &key, idx_t block_idx) {
+	lock_guard<mutex> guard(lock);
+	return blocks.find(GetBlockName(key, block_idx)) != blocks.end();
+}
+
+bool HTTPDiskCache::ReadBlock(const string &key, idx_t block_idx, data_ptr_t buffer, idx_t length) {
+	auto block_name = GetBlockName(key, block_idx);
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = blocks.find(block_name);
+		if (entry == blocks.end()) {
+			return false;
+		}
+		lru.splice(lru.end(), lru, entry->second.lru_position);
+	}
+	// a block consists of the length of the key, the key and the data
+	try {
+		auto handle = fs->OpenFile(GetBlockPath(block_name), FileFlags::FILE_FLAGS_READ);
+		if (idx_t(fs->GetFileSize(*handle)) != sizeof(uint32_t) + key.size() + length) {
+			return false;
+		}
+		uint32_t key_length;
+		fs->Read(*handle, &key_length, sizeof(uint32_t), 0);
+		if (key_length != key.size()) {
+			return false;
+		}
+		string stored_key(key_length, '\0');
+		fs->Read(*handle, (void *)stored_key.data(), key_length, sizeof(uint32_t));
+		if (stored_key != key) {
+			return false;
+		}
+		fs->Read(*handle, buffer, length, sizeof(uint32_t) + key_length);
+	} catch (std::exception &ex) {
+		// the block was evicted in the meantime or could not be read: treat it as a cache miss
+		return false;
+	}
+	return true;
+}
+
+void HTTPDiskCache::WriteBlock(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t length) {
+	auto block_name = GetBlockName(key, block_idx);
+	auto block_path = GetBlockPath(block_name);
+	// write the block to a temporary file first, so readers never observe a partially written block
+	auto temp_path = block_path + "." + to_string(temp_file_count++) + ".tmp";
+	try {
+		{
+			auto handle =
+			    fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			uint32_t key_length = key.size();
+			fs->Write(*handle, &key_length, sizeof(uint32_t), 0);
+			fs->Write(*handle, (void *)key.data(), key_length, sizeof(uint32_t));
+			fs->Write(*handle, (void *)buffer, length, sizeof(uint32_t) + key_length);
+		}
+		fs->MoveFile(temp_path, block_path);
+	} catch (std::exception &ex) {
+		// caching is best-effort: failing to write a block (e.g. because the disk is full) is not an error
+		try {
+			fs->RemoveFile(temp_path);
+		} catch (std::exception &ex) { // NOLINT
+		}
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	AddBlock(block_name, sizeof(uint32_t) + key.size() + length);
+	EvictBlocks();
+}
+
+void HTTPDiskCache::AddBlock(const string &block_name, idx_t size) {
+	auto entry = blocks.find(block_name);
+	if (entry != blocks.end()) {
+		// the block was written concurrently by another thread
+		total_size -= entry->second.size;
+		entry->second.size = size;
+		lru.splice(lru.end(), lru, entry->second.lru_position);
+	} else {
+		CachedBlock block;
+		block.size = size;
+		block.lru_position = lru.insert(lru.end(), block_name);
+		blocks[block_name] = block;
+	}
+	total_size += size;
+}
+
+void HTTPDiskCache::RemoveBlock(const string &block_name) {
+	auto entry = blocks.find(block_name);
+	D_ASSERT(entry != blocks.end());
+	total_size -= entry->second.size;
+	lru.erase(entry->second.lru_position);
+	blocks.erase(entry);
+	try {
+		fs->RemoveFile(GetBlockPath(block_name));
+	} catch (std::exception &ex) { // NOLINT
+	}
+}
+
+void HTTPDiskCache::EvictBlocks() {
+	while (total_size > max_size && !lru.empty()) {
+		auto block_name = lru.front();
+		RemoveBlock(block_name);
+	}
+}
+
+} // namespace duckdb
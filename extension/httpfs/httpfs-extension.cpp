@@ -29,6 +29,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("http_retry_backoff",
 	                          "Backoff factor for exponentially increasing retry wait time (default 4)",
 	                          LogicalType::FLOAT, Value(4));
+	config.AddExtensionOption("http_disk_cache_directory",
+	                          "Directory in which ranges of remote files are cached on disk (disabled by default)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_disk_cache_max_size", "Maximum size of the HTTP disk cache (default 1GB)",
+	                          LogicalType::VARCHAR, Value("1GB"));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR);
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
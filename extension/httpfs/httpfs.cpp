@@ -34,6 +34,8 @@ HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	uint64_t retry_wait_ms = DEFAULT_RETRY_WAIT_MS;
 	float retry_backoff = DEFAULT_RETRY_BACKOFF;
 	bool force_download = DEFAULT_FORCE_DOWNLOAD;
+	string disk_cache_directory;
+	idx_t disk_cache_max_size = DEFAULT_DISK_CACHE_MAX_SIZE;
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
 		timeout = value.GetValue<uint64_t>();
@@ -50,8 +52,15 @@ HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "http_retry_backoff", value)) {
 		retry_backoff = value.GetValue<float>();
 	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_directory", value) && !value.IsNull()) {
+		disk_cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_max_size", value) && !value.IsNull()) {
+		disk_cache_max_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
-	return {timeout, retries, retry_wait_ms, retry_backoff, force_download};
+	return {timeout,        retries,          retry_wait_ms,      retry_backoff,
+	        force_download, disk_cache_directory, disk_cache_max_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -353,8 +362,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, string path, uint8_t flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, uint8_t flags, FileLockType lock,
@@ -390,7 +399,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 	// Don't buffer when DirectIO is set.
 	if (hfh.flags & FileFlags::FILE_FLAGS_DIRECT_IO && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ReadRange(hfh, location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -426,14 +435,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRange(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRange(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -443,6 +451,68 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+shared_ptr<HTTPDiskCache> HTTPFileSystem::GetDiskCache(const HTTPParams &http_params) {
+	if (http_params.disk_cache_directory.empty()) {
+		return nullptr;
+	}
+	lock_guard<mutex> guard(disk_cache_lock);
+	if (!disk_cache || disk_cache->GetDirectory() != http_params.disk_cache_directory) {
+		disk_cache = make_shared<HTTPDiskCache>(http_params.disk_cache_directory, http_params.disk_cache_max_size);
+	} else {
+		disk_cache->SetMaxSize(http_params.disk_cache_max_size);
+	}
+	return disk_cache;
+}
+
+void HTTPFileSystem::ReadRange(HTTPFileHandle &handle, idx_t location, char *buffer, idx_t length) {
+	auto &cache = handle.disk_cache;
+	auto end = location + length;
+	if (!cache || end > handle.length) {
+		GetRangeRequest(handle, handle.path, {}, location, buffer, length);
+		return;
+	}
+	auto &key = handle.disk_cache_key;
+	// copies the part of [data_start, data_end) that was requested into the result buffer
+	auto copy_to_result = [&](data_ptr_t data, idx_t data_start, idx_t data_end) {
+		auto copy_start = MaxValue<idx_t>(location, data_start);
+		auto copy_end = MinValue<idx_t>(end, data_end);
+		memcpy(buffer + (copy_start - location), data + (copy_start - data_start), copy_end - copy_start);
+	};
+
+	// the cache stores aligned blocks of the file: the blocks that are cached are read from disk, and every run of
+	// consecutive blocks that are not is fetched with a single range request
+	auto block_size = HTTPDiskCache::BLOCK_SIZE;
+	auto block_idx = location / block_size;
+	auto end_block_idx = (end + block_size - 1) / block_size;
+	duckdb::unique_ptr<data_t[]> block_buffer;
+	while (block_idx < end_block_idx) {
+		auto block_start = block_idx * block_size;
+		auto block_end = MinValue<idx_t>(block_start + block_size, handle.length);
+		if (!block_buffer) {
+			block_buffer = duckdb::unique_ptr<data_t[]>(new data_t[block_size]);
+		}
+		if (cache->ReadBlock(key, block_idx, block_buffer.get(), block_end - block_start)) {
+			copy_to_result(block_buffer.get(), block_start, block_end);
+			block_idx++;
+			continue;
+		}
+		auto fetch_end_idx = block_idx + 1;
+		while (fetch_end_idx < end_block_idx && !cache->Contains(key, fetch_end_idx)) {
+			fetch_end_idx++;
+		}
+		auto fetch_start = block_start;
+		auto fetch_end = MinValue<idx_t>(fetch_end_idx * block_size, handle.length);
+		auto fetch_buffer = duckdb::unique_ptr<data_t[]>(new data_t[fetch_end - fetch_start]);
+		GetRangeRequest(handle, handle.path, {}, fetch_start, (char *)fetch_buffer.get(), fetch_end - fetch_start);
+		for (; block_idx < fetch_end_idx; block_idx++) {
+			auto block_offset = block_idx * block_size - fetch_start;
+			auto block_length = MinValue<idx_t>(block_size, fetch_end - fetch_start - block_offset);
+			cache->WriteBlock(key, block_idx, fetch_buffer.get() + block_offset, block_length);
+		}
+		copy_to_result(fetch_buffer.get(), fetch_start, fetch_end);
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -542,10 +612,12 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags & FileFlags::FILE_FLAGS_READ) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeDiskCache();
 			return;
 		}
 
@@ -640,10 +712,24 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	etag = res->headers["ETag"];
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	InitializeDiskCache();
+}
+
+void HTTPFileHandle::InitializeDiskCache() {
+	if (!(flags & FileFlags::FILE_FLAGS_READ) || length == 0 || http_params.force_download) {
+		return;
+	}
+	// only files of which we can tell when they change are cached
+	disk_cache_key = HTTPDiskCache::GetFileKey(path, etag, last_modified, length);
+	if (disk_cache_key.empty()) {
+		return;
 	}
+	disk_cache = ((HTTPFileSystem &)file_system).GetDiskCache(http_params);
 }
 
 void HTTPFileHandle::InitializeClient() {
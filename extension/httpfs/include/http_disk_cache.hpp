@@ -0,0 +1,71 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+//! A size-bounded cache of remote file ranges on the local disk. Remote files are divided into blocks of BLOCK_SIZE
+//! bytes, each of which is stored in a separate file in the cache directory. Blocks are keyed by the URL and the
+//! version of the remote file (its ETag, Last-Modified and length), so a file that changes is never served from stale
+//! blocks. The least recently used blocks are evicted once the cache exceeds its maximum size. The cache is shared by
+//! all connections of a database and is safe to use from multiple threads.
+class HTTPDiskCache {
+public:
+	static constexpr idx_t BLOCK_SIZE = 1 << 20;
+	//! Temporary files of unfinished writes are only removed once they have not been modified for this many seconds
+	static constexpr time_t STALE_TEMP_FILE_AGE = 3600;
+
+	HTTPDiskCache(string directory, idx_t max_size);
+
+	//! Returns the key that identifies the current version of a remote file, or an empty string if the version of the
+	//! file cannot be determined (in which case it should not be cached)
+	static string GetFileKey(const string &url, const string &etag, time_t last_modified, idx_t length);
+
+	//! Reads a cached block of a file into the buffer. Returns false if the block is not cached.
+	bool ReadBlock(const string &key, idx_t block_idx, data_ptr_t buffer, idx_t length);
+	//! Stores a block of a file in the cache, evicting the least recently used blocks if the cache is full
+	void WriteBlock(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t length);
+	//! Whether or not a block of a file is cached
+	bool Contains(const string &key, idx_t block_idx);
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+	void SetMaxSize(idx_t max_size);
+
+private:
+	struct CachedBlock {
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+
+	string GetBlockPath(const string &block_name);
+	static string GetBlockName(const string &key, idx_t block_idx);
+	//! Registers a block that was written to disk, the lock must be held
+	void AddBlock(const string &block_name, idx_t size);
+	//! Removes a block from the cache and from disk, the lock must be held
+	void RemoveBlock(const string &block_name);
+	//! Evicts blocks until the cache fits within its maximum size, the lock must be held
+	void EvictBlocks();
+
+private:
+	string directory;
+	idx_t max_size;
+	unique_ptr<FileSystem> fs;
+
+	mutex lock;
+	//! The cached blocks, from least to most recently used
+	list<string> lru;
+	unordered_map<string, CachedBlock> blocks;
+	idx_t total_size;
+	//! Used to give concurrent writers unique temporary files
+	atomic<idx_t> temp_file_count;
+};
+
+} // namespace duckdb
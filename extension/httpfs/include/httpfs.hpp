@@ -6,6 +6,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_disk_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -34,12 +35,16 @@ struct HTTPParams {
 	static constexpr uint64_t DEFAULT_RETRY_WAIT_MS = 100;
 	static constexpr float DEFAULT_RETRY_BACKOFF = 4;
 	static constexpr bool DEFAULT_FORCE_DOWNLOAD = false;
+	static constexpr idx_t DEFAULT_DISK_CACHE_MAX_SIZE = idx_t(1) << 30; // 1 GiB
 
 	uint64_t timeout;
 	uint64_t retries;
 	uint64_t retry_wait_ms;
 	float retry_backoff;
 	bool force_download;
+	// The directory in which remote file ranges are cached, the disk cache is disabled if this is empty
+	string disk_cache_directory;
+	idx_t disk_cache_max_size;
 
 	static HTTPParams ReadFrom(FileOpener *opener);
 };
@@ -60,6 +65,7 @@ public:
 	uint8_t flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 	bool range_read = true;
 
 	// Read info
@@ -75,12 +81,17 @@ public:
 
 	shared_ptr<HTTPState> state;
 
+	// The disk cache that ranges of this file are read from and written to, if any
+	shared_ptr<HTTPDiskCache> disk_cache;
+	string disk_cache_key;
+
 public:
 	void Close() override {
 	}
 
 protected:
 	virtual void InitializeClient();
+	void InitializeDiskCache();
 };
 
 class HTTPFileSystem : public FileSystem {
@@ -141,9 +152,19 @@ public:
 	// Global cache
 	duckdb::unique_ptr<HTTPMetadataCache> global_metadata_cache;
 
+	// Returns the disk cache for the configured directory, or nullptr if the disk cache is disabled
+	shared_ptr<HTTPDiskCache> GetDiskCache(const HTTPParams &http_params);
+
 protected:
+	// Reads a range of the file, using the disk cache if it is enabled
+	void ReadRange(HTTPFileHandle &handle, idx_t location, char *buffer, idx_t length);
+
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, uint8_t flags, FileLockType lock,
 	                                                        FileCompressionType compression, FileOpener *opener);
+
+private:
+	mutex disk_cache_lock;
+	shared_ptr<HTTPDiskCache> disk_cache;
 };
 
 } // namespace duckdb
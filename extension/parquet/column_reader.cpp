@@ -16,6 +16,7 @@
 #include "snappy.h"
 #include "miniz_wrapper.hpp"
 #include "zstd.h"
+#include "lz4.hpp"
 #include <iostream>
 
 #include "duckdb.hpp"
@@ -159,6 +160,16 @@ uint64_t ColumnReader::TotalCompressedSize() {
 	return chunk->meta_data.total_compressed_size;
 }
 
+bool ColumnReader::CanSeekToRow(const vector<ColumnChunk> &columns) {
+	if (HasRepeats()) {
+		// pages of repeated columns do not start at row boundaries
+		return false;
+	}
+	auto &column_chunk = columns[FileIdx()];
+	return column_chunk.__isset.offset_index_offset && column_chunk.__isset.offset_index_length &&
+	       column_chunk.offset_index_length > 0;
+}
+
 // Note: It's not trivial to determine where all Column data is stored. Chunk->file_offset
 // apparently is not the first page of the data. Therefore we determine the address of the first page by taking the
 // minimum of all page offsets.
@@ -217,6 +228,11 @@ void ColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, // NOLINT
 	throw NotImplementedException("DeltaByteArray");
 }
 
+bool ColumnReader::DictionaryOffsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, // NOLINT
+                                     Vector &result) {
+	return false;
+}
+
 void ColumnReader::DictReference(Vector &result) {
 }
 void ColumnReader::PlainReference(shared_ptr<ByteBuffer>, Vector &result) { // NOLINT
@@ -240,6 +256,40 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index_loaded = false;
+	offset_index.reset();
+}
+
+const OffsetIndex *ColumnReader::GetOffsetIndex() {
+	if (offset_index_loaded) {
+		return offset_index.get();
+	}
+	offset_index_loaded = true;
+	if (!chunk || HasRepeats() || !chunk->__isset.offset_index_offset || !chunk->__isset.offset_index_length ||
+	    chunk->offset_index_length <= 0) {
+		// pages of repeated columns do not start at row boundaries, so we cannot jump to them
+		return nullptr;
+	}
+	// the index is read through a separate read head, so the reader has to seek back to chunk_read_offset afterwards
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.RegisterPrefetch(chunk->offset_index_offset, chunk->offset_index_length, false);
+	trans.SetLocation(chunk->offset_index_offset);
+	auto result = make_uniq<OffsetIndex>();
+	result->read(protocol);
+	trans.SetLocation(chunk_read_offset);
+
+	auto &pages = result->page_locations;
+	if (pages.empty() || pages[0].first_row_index != 0) {
+		return nullptr;
+	}
+	for (idx_t page_idx = 1; page_idx < pages.size(); page_idx++) {
+		if (pages[page_idx].first_row_index <= pages[page_idx - 1].first_row_index ||
+		    pages[page_idx].offset <= pages[page_idx - 1].offset) {
+			return nullptr;
+		}
+	}
+	offset_index = std::move(result);
+	return offset_index.get();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -337,6 +387,38 @@ void ColumnReader::PreparePage(PageHeader &page_hdr) {
 	                   page_hdr.uncompressed_page_size);
 }
 
+static uint32_t LoadBigEndian32(const_data_ptr_t ptr) {
+	return uint32_t(ptr[0]) << 24 | uint32_t(ptr[1]) << 16 | uint32_t(ptr[2]) << 8 | uint32_t(ptr[3]);
+}
+
+//! Decompresses LZ4 data with the Hadoop framing, which splits the data into blocks that are each prefixed with their
+//! big-endian decompressed and compressed size. Returns false if the data does not use this framing.
+static bool DecompressHadoopLz4(const_data_ptr_t src, idx_t src_size, data_ptr_t dst, idx_t dst_size) {
+	static constexpr const idx_t PREFIX_SIZE = 2 * sizeof(uint32_t);
+	while (src_size > 0) {
+		if (src_size < PREFIX_SIZE) {
+			return false;
+		}
+		idx_t block_decompressed_size = LoadBigEndian32(src);
+		idx_t block_compressed_size = LoadBigEndian32(src + sizeof(uint32_t));
+		src += PREFIX_SIZE;
+		src_size -= PREFIX_SIZE;
+		if (block_compressed_size > src_size || block_decompressed_size > dst_size) {
+			return false;
+		}
+		auto res = duckdb_lz4::LZ4_decompress_safe(const_char_ptr_cast(src), char_ptr_cast(dst),
+		                                           block_compressed_size, block_decompressed_size);
+		if (res < 0 || idx_t(res) != block_decompressed_size) {
+			return false;
+		}
+		src += block_compressed_size;
+		src_size -= block_compressed_size;
+		dst += block_decompressed_size;
+		dst_size -= block_decompressed_size;
+	}
+	return dst_size == 0;
+}
+
 void ColumnReader::DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size,
                                       data_ptr_t dst, idx_t dst_size) {
 	switch (codec) {
@@ -371,11 +453,29 @@ void ColumnReader::DecompressInternal(CompressionCodec::type codec, const_data_p
 		}
 		break;
 	}
+	case CompressionCodec::LZ4_RAW: {
+		auto res = duckdb_lz4::LZ4_decompress_safe(const_char_ptr_cast(src), char_ptr_cast(dst), src_size, dst_size);
+		if (res != int(dst_size)) {
+			throw std::runtime_error("LZ4 decompression failure");
+		}
+		break;
+	}
+	case CompressionCodec::LZ4: {
+		// the deprecated LZ4 codec is ambiguous: most writers use the Hadoop framing, but some write plain LZ4 blocks
+		if (!DecompressHadoopLz4(src, src_size, dst, dst_size)) {
+			auto res =
+			    duckdb_lz4::LZ4_decompress_safe(const_char_ptr_cast(src), char_ptr_cast(dst), src_size, dst_size);
+			if (res != int(dst_size)) {
+				throw std::runtime_error("LZ4 decompression failure");
+			}
+		}
+		break;
+	}
 	default: {
 		std::stringstream codec_name;
 		codec_name << codec;
 		throw std::runtime_error("Unsupported compression codec \"" + codec_name.str() +
-		                         "\". Supported options are uncompressed, gzip, snappy or zstd");
+		                         "\". Supported options are uncompressed, gzip, snappy, zstd or lz4");
 	}
 	}
 }
@@ -445,6 +545,10 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 		PrepareDeltaByteArray(*block);
 		break;
 	}
+	case Encoding::BYTE_STREAM_SPLIT: {
+		PrepareByteStreamSplit(*block);
+		break;
+	}
 	case Encoding::PLAIN:
 		// nothing to do here, will be read directly below
 		break;
@@ -454,6 +558,39 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 	}
 }
 
+void ColumnReader::PrepareByteStreamSplit(ResizeableBuffer &buffer) {
+	idx_t value_size;
+	switch (schema.type) {
+	case Type::FLOAT:
+	case Type::INT32:
+		value_size = sizeof(uint32_t);
+		break;
+	case Type::DOUBLE:
+	case Type::INT64:
+		value_size = sizeof(uint64_t);
+		break;
+	case Type::FIXED_LEN_BYTE_ARRAY:
+		value_size = schema.type_length;
+		break;
+	default:
+		throw std::runtime_error("BYTE_STREAM_SPLIT encoding is only supported for fixed size values");
+	}
+	if (value_size == 0) {
+		throw std::runtime_error("BYTE_STREAM_SPLIT - invalid value size - corrupt file?");
+	}
+	// the k-th byte of every value is stored in the k-th stream, we reassemble the values in place after which they
+	// are read like plain values (the block has one byte of padding, so we round down)
+	auto value_count = buffer.len / value_size;
+	auto split_data = make_unsafe_uniq_array<data_t>(buffer.len);
+	memcpy(split_data.get(), buffer.ptr, buffer.len);
+	for (idx_t byte_idx = 0; byte_idx < value_size; byte_idx++) {
+		auto stream = split_data.get() + byte_idx * value_count;
+		for (idx_t i = 0; i < value_count; i++) {
+			buffer.ptr[i * value_size + byte_idx] = stream[i];
+		}
+	}
+}
+
 idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
                          Vector &result) {
 	// we need to reset the location because multiple column readers share the same protocol
@@ -464,6 +601,12 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 	if (pending_skips > 0) {
 		ApplyPendingSkips(pending_skips);
 	}
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		// an earlier read turned the result into a dictionary vector that shares the data of the page dictionary
+		// give it its own buffers again, so the values written below do not end up in the dictionary
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		result.Initialize();
+	}
 
 	idx_t result_offset = 0;
 	auto to_read = num_values;
@@ -502,9 +645,13 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+			// if the entire read comes from this page we can reference the dictionary instead of copying its values
+			if (!allow_dictionary_output || read_now != num_values ||
+			    !DictionaryOffsets(offsets, define_out, read_now, result)) {
+				DictReference(result);
+				Offsets(offsets, define_out, read_now, filter, result_offset, result);
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared<ResizeableBuffer>();
@@ -555,15 +702,58 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (num_values <= page_rows_available) {
+		return 0;
+	}
+	auto index = GetOffsetIndex();
+	if (!index) {
+		return 0;
+	}
+	auto &pages = index->page_locations;
+	auto current_row = idx_t(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+
+	// find the last page that starts at or before the target row
+	idx_t page_idx = 0;
+	while (page_idx + 1 < pages.size() && idx_t(pages[page_idx + 1].first_row_index) <= target_row) {
+		page_idx++;
+	}
+	if (idx_t(pages[page_idx].first_row_index) <= current_row) {
+		// the target row is in the current page
+		return 0;
+	}
+
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (chunk_read_offset < idx_t(pages[0].offset)) {
+		// the dictionary page precedes the data pages, we need it to decode the pages we jump to
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+	}
+	auto skipped_rows = pages[page_idx].first_row_index - current_row;
+	chunk_read_offset = pages[page_idx].offset;
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+	group_rows_available -= skipped_rows;
+	return skipped_rows;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// jump over the pages we do not need to decode at all
+	num_values -= SkipPages(num_values);
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
 	// TODO this can be optimized, for example we dont actually have to bitunpack offsets
 	Vector dummy_result(type, nullptr);
 
+	// the skipped values are never used, so there is no point in emitting dictionary vectors for them
+	auto allow_dictionary = allow_dictionary_output;
+	allow_dictionary_output = false;
+
 	idx_t remaining = num_values;
 	idx_t read = 0;
 
@@ -572,6 +762,7 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 		read += Read(to_read, none_filter, dummy_define.ptr, dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
 	}
+	allow_dictionary_output = allow_dictionary;
 
 	if (read != num_values) {
 		throw std::runtime_error("Row count mismatch when skipping rows");
@@ -612,9 +803,21 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 	return VerifyString(str_data, str_len, Type() == LogicalTypeId::VARCHAR);
 }
 
+class ParquetStringVectorBuffer : public VectorBuffer {
+public:
+	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
+	}
+
+private:
+	shared_ptr<ByteBuffer> buffer;
+};
+
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
-	dict_strings = duckdb::unique_ptr<string_t[]>(new string_t[num_entries]);
+	dictionary = make_uniq<Vector>(Type(), num_entries + 1);
+	dictionary_size = num_entries;
+	auto dict_strings = FlatVector::GetData<string_t>(*dictionary);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
 		if (fixed_width_string_length == 0) {
@@ -631,6 +834,30 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 		dict_strings[dict_idx] = string_t(dict_str, actual_str_len);
 		dict->inc(str_len);
 	}
+	FlatVector::SetNull(*dictionary, num_entries, true);
+	StringVector::AddBuffer(*dictionary, make_buffer<ParquetStringVectorBuffer>(dict));
+}
+
+bool StringColumnReader::DictionaryOffsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) {
+	if (!dictionary) {
+		return false;
+	}
+	SelectionVector sel(num_values);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			// NULL values refer to the NULL entry at the end of the dictionary
+			sel.set_index(row_idx, dictionary_size);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= dictionary_size) {
+			throw std::runtime_error("Parquet dictionary offset out of range - corrupt file?");
+		}
+		sel.set_index(row_idx, offset);
+	}
+	result.Slice(*dictionary, sel, num_values);
+	return true;
 }
 
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
@@ -728,16 +955,6 @@ void StringColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, parq
 	StringVector::AddHeapReference(result, *byte_array_data);
 }
 
-class ParquetStringVectorBuffer : public VectorBuffer {
-public:
-	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
-	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
-	}
-
-private:
-	shared_ptr<ByteBuffer> buffer;
-};
-
 void StringColumnReader::DictReference(Vector &result) {
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(dict));
 }
@@ -746,8 +963,8 @@ void StringColumnReader::PlainReference(shared_ptr<ByteBuffer> plain_data, Vecto
 }
 
 string_t StringParquetValueConversion::DictRead(ByteBuffer &dict, uint32_t &offset, ColumnReader &reader) {
-	auto &dict_strings = reader.Cast<StringColumnReader>().dict_strings;
-	return dict_strings[offset];
+	auto &dictionary = *reader.Cast<StringColumnReader>().dictionary;
+	return FlatVector::GetData<string_t>(dictionary)[offset];
 }
 
 string_t StringParquetValueConversion::PlainRead(ByteBuffer &plain_data, ColumnReader &reader) {
@@ -1072,6 +1289,15 @@ uint64_t StructColumnReader::TotalCompressedSize() {
 	return size;
 }
 
+bool StructColumnReader::CanSeekToRow(const vector<ColumnChunk> &columns) {
+	for (auto &child : child_readers) {
+		if (!child->CanSeekToRow(columns)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 static bool TypeHasExactRowCount(const LogicalType &type) {
 	switch (type.id()) {
 	case LogicalTypeId::LIST:
@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -20,6 +21,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #endif
 
+#include "lz4.hpp"
 #include "miniz_wrapper.hpp"
 #include "snappy.h"
 #include "zstd.h"
@@ -29,12 +31,14 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -83,6 +87,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -169,6 +176,56 @@ void RleBpEncoder::FinishWrite(Serializer &writer) {
 	WriteRun(writer);
 }
 
+//===--------------------------------------------------------------------===//
+// DbpEncoder
+//===--------------------------------------------------------------------===//
+uint8_t DbpEncoder::BitWidth(uint64_t value) {
+	uint8_t result = 0;
+	while (result < 64 && (value >> result) != 0) {
+		result++;
+	}
+	return result;
+}
+
+void DbpEncoder::WriteVarint(Serializer &writer, uint64_t value) {
+	do {
+		uint8_t byte = value & 127;
+		value >>= 7;
+		if (value != 0) {
+			byte |= 128;
+		}
+		writer.Write<uint8_t>(byte);
+	} while (value != 0);
+}
+
+void DbpEncoder::WriteZigzag(Serializer &writer, int64_t value) {
+	WriteVarint(writer, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void DbpEncoder::BitPack(Serializer &writer, const uint64_t *values, idx_t count, uint8_t bit_width) {
+	uint64_t buffer = 0;
+	idx_t buffer_bits = 0;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t written_bits = 0;
+		while (written_bits < bit_width) {
+			auto bits = MinValue<idx_t>(bit_width - written_bits, 64 - buffer_bits);
+			auto mask = bits == 64 ? NumericLimits<uint64_t>::Maximum() : (uint64_t(1) << bits) - 1;
+			buffer |= ((values[i] >> written_bits) & mask) << buffer_bits;
+			buffer_bits += bits;
+			written_bits += bits;
+			if (buffer_bits == 64) {
+				writer.Write<uint64_t>(buffer);
+				buffer = 0;
+				buffer_bits = 0;
+			}
+		}
+	}
+	// write the remaining bytes
+	for (idx_t byte_idx = 0; byte_idx * 8 < buffer_bits; byte_idx++) {
+		writer.Write<uint8_t>(uint8_t(buffer >> (byte_idx * 8)));
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // ColumnWriter
 //===--------------------------------------------------------------------===//
@@ -217,6 +274,23 @@ void ColumnWriter::CompressPage(BufferedSerializer &temp_writer, size_t &compres
 		compressed_data = compressed_buf.get();
 		break;
 	}
+	case CompressionCodec::LZ4_RAW: {
+		if (temp_writer.blob.size > LZ4_MAX_INPUT_SIZE) {
+			throw InternalException("Parquet writer: page of %llu bytes is too large for LZ4 compression",
+			                        temp_writer.blob.size);
+		}
+		compressed_size = duckdb_lz4::LZ4_compressBound(temp_writer.blob.size);
+		compressed_buf = duckdb::unique_ptr<data_t[]>(new data_t[compressed_size]);
+		auto result = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(temp_writer.blob.data.get()),
+		                                               char_ptr_cast(compressed_buf.get()), temp_writer.blob.size,
+		                                               compressed_size);
+		if (result <= 0) {
+			throw InternalException("Parquet writer: LZ4 compression failure");
+		}
+		compressed_size = result;
+		compressed_data = compressed_buf.get();
+		break;
+	}
 	default:
 		throw InternalException("Unsupported codec for Parquet Writer");
 	}
@@ -305,6 +379,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	duckdb::unique_ptr<BufferedSerializer> temp_writer;
 	duckdb::unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, only gathered if we write a page index
+	duckdb::unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -326,6 +402,7 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	duckdb::unique_ptr<ColumnWriterStatistics> stats_state;
+	duckdb::unique_ptr<ParquetBloomFilterBuilder> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -342,9 +419,6 @@ public:
 
 	~BasicColumnWriter() override = default;
 
-	//! We limit the uncompressed page size to 100MB
-	// The max size in Parquet is 2GB, but we choose a more conservative limit
-	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//  For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -353,6 +427,8 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	// the size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	// the (conservatively estimated) size of the delta encoded prefix and suffix lengths of a string
+	static constexpr const idx_t DELTA_LENGTHS_SIZE = sizeof(uint32_t);
 
 public:
 	duckdb::unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group,
@@ -371,6 +447,16 @@ protected:
 	void NextPage(BasicColumnWriterState &state);
 	void FlushPage(BasicColumnWriterState &state);
 
+	//! Whether or not we gather the statistics of individual pages for the page index. The page index stores the
+	//! first row of every page, so we only write it for columns that are not repeated.
+	bool WritePageStatistics() {
+		return writer.WritePageIndex() && max_repeat == 0;
+	}
+	//! Creates the page index of the column chunk, after its pages have been written
+	unique_ptr<ParquetPageIndex> CreatePageIndex(BasicColumnWriterState &state, const vector<PageLocation> &locations);
+	//! Inserts the non-null values of a vector in the Bloom filter. Only used for types that support Bloom filters.
+	virtual void UpdateBloomFilter(ParquetBloomFilterBuilder &bloom_filter, Vector &vector, idx_t count);
+
 	//! Initializes the state used to track statistics during writing. Only used for scalar types.
 	virtual duckdb::unique_ptr<ColumnWriterStatistics> InitializeStatsState();
 
@@ -445,7 +531,7 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= writer.GetPageSize()) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -464,6 +550,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (writer.HasBloomFilter(schema_idx)) {
+		state.bloom_filter = make_uniq<ParquetBloomFilterBuilder>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -488,6 +577,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (WritePageStatistics()) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -558,6 +650,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.blob.size > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -587,8 +682,15 @@ idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWrit
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
 }
 
+void BasicColumnWriter::UpdateBloomFilter(ParquetBloomFilterBuilder &bloom_filter, Vector &vector, idx_t count) {
+	throw InternalException("Bloom filters are not supported for this column writer");
+}
+
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter) {
+		UpdateBloomFilter(*state.bloom_filter, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -601,8 +703,8 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -677,6 +779,7 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<PageLocation> page_locations;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
@@ -685,9 +788,66 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		column_writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			PageLocation location;
+			location.offset = header_start_offset;
+			location.compressed_page_size = column_writer.GetTotalWritten() - header_start_offset;
+			location.first_row_index = state.page_info[page_locations.size()].offset;
+			page_locations.push_back(location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (WritePageStatistics()) {
+		writer.AddPageIndex(state.col_idx, CreatePageIndex(state, page_locations));
+	}
+	if (state.bloom_filter) {
+		writer.AddBloomFilter(state.col_idx, state.bloom_filter->Finalize());
+	}
+}
+
+unique_ptr<ParquetPageIndex> BasicColumnWriter::CreatePageIndex(BasicColumnWriterState &state,
+                                                                const vector<PageLocation> &locations) {
+	auto result = make_uniq<ParquetPageIndex>();
+	result->offset_index.page_locations = locations;
+
+	// the column index can only be written if we have a min and max for every page that has values
+	result->has_column_index = true;
+	auto &column_index = result->column_index;
+	column_index.boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index.__isset.null_counts = true;
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type != PageType::DATA_PAGE) {
+			continue;
+		}
+		auto &page_info = state.page_info[page_idx++];
+		int64_t page_null_count = 0;
+		for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+			if (state.definition_levels[i] != max_define) {
+				page_null_count++;
+			}
+		}
+		column_index.null_counts.push_back(page_null_count);
+		if (idx_t(page_null_count) == page_info.row_count) {
+			// pages without values have empty bounds
+			column_index.null_pages.push_back(true);
+			column_index.min_values.emplace_back();
+			column_index.max_values.emplace_back();
+			continue;
+		}
+		auto min_value = write_info.page_stats->GetMinValue();
+		auto max_value = write_info.page_stats->GetMaxValue();
+		if (min_value.empty() || max_value.empty()) {
+			result->has_column_index = false;
+			break;
+		}
+		column_index.null_pages.push_back(false);
+		column_index.min_values.push_back(std::move(min_value));
+		column_index.max_values.push_back(std::move(max_value));
+	}
+	return result;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -757,6 +917,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -827,6 +996,64 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+//! Whether or not values of a physical type can be written with the DELTA_BINARY_PACKED encoding
+template <class T>
+struct DeltaBinaryPackedEncoding {
+	static constexpr const bool SUPPORTED = false;
+
+	static void Encode(Serializer &writer, const T *values, idx_t count) {
+		throw InternalException("DELTA_BINARY_PACKED encoding is only supported for INT32 and INT64 values");
+	}
+};
+
+template <>
+struct DeltaBinaryPackedEncoding<int32_t> {
+	static constexpr const bool SUPPORTED = true;
+
+	static void Encode(Serializer &writer, const int32_t *values, idx_t count) {
+		DbpEncoder::Encode<int32_t>(writer, values, count);
+	}
+};
+
+template <>
+struct DeltaBinaryPackedEncoding<int64_t> {
+	static constexpr const bool SUPPORTED = true;
+
+	static void Encode(Serializer &writer, const int64_t *values, idx_t count) {
+		DbpEncoder::Encode<int64_t>(writer, values, count);
+	}
+};
+
+template <class TGT>
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	// analysis state, used to estimate the size of the DELTA_BINARY_PACKED encoding
+	idx_t value_count = 0;
+	TGT previous_value = TGT();
+	int64_t min_delta = NumericLimits<int64_t>::Maximum();
+	int64_t max_delta = NumericLimits<int64_t>::Minimum();
+	int64_t min_value = NumericLimits<int64_t>::Maximum();
+	int64_t max_value = NumericLimits<int64_t>::Minimum();
+
+	duckdb_parquet::format::Encoding::type encoding = Encoding::PLAIN;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	explicit StandardWriterPageState(duckdb_parquet::format::Encoding::type encoding) : encoding(encoding) {
+	}
+
+	duckdb_parquet::format::Encoding::type encoding;
+	//! The values of the page, these are buffered because they can only be encoded once the page is complete
+	vector<TGT> values;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -836,15 +1063,153 @@ public:
 	}
 	~StandardColumnWriter() override = default;
 
+	//! Integers are only delta encoded if they are not converted, as the reader decodes the deltas straight into
+	//! the result type
+	static constexpr const bool SUPPORTS_DELTA =
+	    std::is_same<SRC, TGT>::value && DeltaBinaryPackedEncoding<TGT>::SUPPORTED;
+	static constexpr const bool SUPPORTS_BYTE_STREAM_SPLIT =
+	    std::is_same<SRC, TGT>::value && std::is_floating_point<TGT>::value;
+
+	//! The zigzag encoded first value of a page must fit in a signed 64-bit integer for the reader to decode it
+	static constexpr const int64_t MAX_DELTA_ENCODED_VALUE = int64_t(1) << 62;
+
 public:
 	duckdb::unique_ptr<ColumnWriterStatistics> InitializeStatsState() override {
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	duckdb::unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group,
+	                                                           Allocator &allocator) override {
+		auto result = make_uniq<StandardColumnWriterState<TGT>>(row_group, row_group.columns.size());
+		if (SUPPORTS_BYTE_STREAM_SPLIT && writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the bytes of floating point values does not change their size, but it groups the sign and
+			// exponent bytes together which makes them compress a lot better
+			result->encoding = Encoding::BYTE_STREAM_SPLIT;
+		}
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		return SUPPORTS_DELTA;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				TGT value = OP::template Operation<SRC, TGT>(ptr[vector_index]);
+				if (state.value_count > 0) {
+					// compute the delta in unsigned arithmetic to avoid signed overflow
+					auto delta = int64_t(uint64_t(int64_t(value)) - uint64_t(int64_t(state.previous_value)));
+					state.min_delta = MinValue<int64_t>(state.min_delta, delta);
+					state.max_delta = MaxValue<int64_t>(state.max_delta, delta);
+				}
+				state.min_value = MinValue<int64_t>(state.min_value, int64_t(value));
+				state.max_value = MaxValue<int64_t>(state.max_value, int64_t(value));
+				state.previous_value = value;
+				state.value_count++;
+			}
+			vector_index++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		if (state.value_count < 2 || state.min_value <= -MAX_DELTA_ENCODED_VALUE ||
+		    state.max_value >= MAX_DELTA_ENCODED_VALUE) {
+			return;
+		}
+		// the deltas relative to the minimum delta fit in this many bits, miniblocks can use fewer bits
+		auto bit_width = DbpEncoder::BitWidth(uint64_t(state.max_delta) - uint64_t(state.min_delta));
+		// every block of deltas also stores its minimum delta and the bit widths of its miniblocks
+		auto block_count = state.value_count / DbpEncoder::BLOCK_SIZE + 1;
+		auto estimated_delta_size = state.value_count * bit_width / 8 +
+		                            block_count * (sizeof(int64_t) + DbpEncoder::MINIBLOCKS_PER_BLOCK);
+		if (estimated_delta_size < state.value_count * sizeof(TGT)) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		return state_p.Cast<StandardColumnWriterState<TGT>>().encoding;
+	}
+
+	duckdb::unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+		auto encoding = GetEncoding(state_p);
+		if (encoding == Encoding::PLAIN) {
+			return nullptr;
+		}
+		return make_uniq<StandardWriterPageState<TGT>>(encoding);
+	}
+
+	void WriteVector(Serializer &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (!page_state_p) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		// buffer the values, they are encoded when the page is flushed
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+				page_state.values.push_back(target_value);
+			}
+		}
+	}
+
+	void FlushPageState(Serializer &temp_writer, ColumnWriterPageState *page_state_p) override {
+		if (!page_state_p) {
+			return;
+		}
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
+		auto &values = page_state.values;
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED:
+			DeltaBinaryPackedEncoding<TGT>::Encode(temp_writer, values.data(), values.size());
+			break;
+		case Encoding::BYTE_STREAM_SPLIT: {
+			// the k-th byte of every value is written to the k-th stream
+			auto split_data = make_unsafe_uniq_array<data_t>(values.size() * sizeof(TGT));
+			auto value_data = const_data_ptr_cast(values.data());
+			for (idx_t i = 0; i < values.size(); i++) {
+				for (idx_t byte_idx = 0; byte_idx < sizeof(TGT); byte_idx++) {
+					split_data[byte_idx * values.size() + i] = value_data[i * sizeof(TGT) + byte_idx];
+				}
+			}
+			temp_writer.WriteData(split_data.get(), values.size() * sizeof(TGT));
+			break;
+		}
+		default:
+			throw InternalException("Unsupported encoding for StandardColumnWriter");
+		}
+		// release the buffered values
+		vector<TGT>().swap(values);
+	}
+
+	void UpdateBloomFilter(ParquetBloomFilterBuilder &bloom_filter, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				// values are hashed in their plain encoding
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				bloom_filter.Insert(ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+			}
+		}
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
@@ -880,6 +1245,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1011,6 +1381,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1192,6 +1569,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.HasStats()) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1205,12 +1595,17 @@ public:
 	idx_t estimated_dict_page_size = 0;
 	idx_t estimated_rle_pages_size = 0;
 	idx_t estimated_plain_size = 0;
+	idx_t estimated_delta_size = 0;
+	// the last value that was analyzed, to compute the shared prefix with the next value
+	string previous_value;
 
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
 	StringHeap dictionary_heap;
-	// key_bit_width== 0 signifies the chunk is written in plain encoding
+	// key_bit_width== 0 signifies the chunk is written in plain or delta encoding
 	uint32_t key_bit_width;
+	// whether or not the chunk is written using the DELTA_BYTE_ARRAY encoding
+	bool delta_encoded = false;
 
 	bool IsDictionaryEncoded() {
 		return key_bit_width != 0;
@@ -1219,8 +1614,10 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool update_stats,
+	                               bool delta_encoded)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false),
+	      update_stats(update_stats), delta_encoded(delta_encoded) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
@@ -1232,8 +1629,30 @@ public:
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+	//! Whether or not the statistics are updated for dictionary encoded values, which is only required for the
+	//! statistics of individual pages (the column statistics are computed from the dictionary)
+	bool update_stats;
+
+	// DELTA_BYTE_ARRAY state, the prefix and suffix lengths precede the suffixes so the page is written when flushed
+	bool delta_encoded;
+	string previous_value;
+	vector<int32_t> prefix_lengths;
+	vector<int32_t> suffix_lengths;
+	BufferedSerializer suffixes;
 };
 
+//! Returns the length of the longest common prefix of two strings
+static idx_t CommonPrefixLength(const string_t &left, const string_t &right) {
+	auto left_data = left.GetData();
+	auto right_data = right.GetData();
+	auto max_length = MinValue<idx_t>(left.GetSize(), right.GetSize());
+	idx_t length = 0;
+	while (length < max_length && left_data[length] == right_data[length]) {
+		length++;
+	}
+	return length;
+}
+
 class StringColumnWriter : public BasicColumnWriter {
 public:
 	StringColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path_p, idx_t max_repeat,
@@ -1270,6 +1689,8 @@ public:
 		idx_t run_length = 0;
 		idx_t run_count = 0;
 		auto strings = FlatVector::GetData<string_t>(vector);
+		string_t previous_value(state.previous_value);
+		bool has_values = false;
 		for (idx_t i = 0; i < vcount; i++) {
 
 			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
@@ -1285,6 +1706,10 @@ public:
 				                       state.dictionary_heap.AddBlob(value), new_value_index))
 				                 : state.dictionary.insert(string_map_t<uint32_t>::value_type(value, new_value_index));
 				state.estimated_plain_size += value.GetSize() + STRING_LENGTH_SIZE;
+				state.estimated_delta_size +=
+				    value.GetSize() - CommonPrefixLength(previous_value, value) + DELTA_LENGTHS_SIZE;
+				previous_value = value;
+				has_values = true;
 				if (found.second) {
 					// string didn't exist yet in the dictionary
 					new_value_index++;
@@ -1304,6 +1729,9 @@ public:
 		// Add the costs of keys sizes. We don't know yet how many bytes the keys need as we haven't
 		// seen all the values. therefore we use an over-estimation of
 		state.estimated_rle_pages_size += MAX_DICTIONARY_KEY_SIZE * run_count;
+		if (has_values) {
+			state.previous_value = previous_value.GetString();
+		}
 	}
 
 	void FinalizeAnalyze(ColumnWriterState &state_p) override {
@@ -1313,9 +1741,12 @@ public:
 		// be too large
 		if (state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		    state.estimated_rle_pages_size + state.estimated_dict_page_size > state.estimated_plain_size) {
-			// clearing the dictionary signals a plain write
+			// clearing the dictionary signals a plain or delta write
 			state.dictionary.clear();
 			state.key_bit_width = 0;
+			// storing only the suffixes that differ from the previous value is more expensive to decode, so we only
+			// do so if it saves at least a quarter of the plain size
+			state.delta_encoded = state.estimated_delta_size * 4 < state.estimated_plain_size * 3;
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
 		}
@@ -1335,6 +1766,9 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (page_state.update_stats) {
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1346,6 +1780,20 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.delta_encoded) {
+			// delta page, we only store the suffix that differs from the previous value
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				auto prefix_length = CommonPrefixLength(string_t(page_state.previous_value), ptr[r]);
+				auto suffix_length = ptr[r].GetSize() - prefix_length;
+				page_state.prefix_lengths.push_back(int32_t(prefix_length));
+				page_state.suffix_lengths.push_back(int32_t(suffix_length));
+				page_state.suffixes.WriteData(const_data_ptr_cast(ptr[r].GetData()) + prefix_length, suffix_length);
+				page_state.previous_value = ptr[r].GetString();
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1359,13 +1807,30 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(ParquetBloomFilterBuilder &bloom_filter, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				bloom_filter.Insert(ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
 	duckdb::unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, WritePageStatistics(),
+		                                        state.delta_encoded);
 	}
 
 	void FlushPageState(Serializer &temp_writer, ColumnWriterPageState *state_p) override {
 		auto &page_state = state_p->Cast<StringWriterPageState>();
+		if (page_state.delta_encoded) {
+			DbpEncoder::Encode<int32_t>(temp_writer, page_state.prefix_lengths.data(), page_state.prefix_lengths.size());
+			DbpEncoder::Encode<int32_t>(temp_writer, page_state.suffix_lengths.data(), page_state.suffix_lengths.size());
+			temp_writer.WriteData(page_state.suffixes.blob.data.get(), page_state.suffixes.blob.size);
+			return;
+		}
 		if (page_state.bit_width != 0) {
 			if (!page_state.written_value) {
 				// all values are null
@@ -1379,7 +1844,10 @@ public:
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		return state.delta_encoded ? Encoding::DELTA_BYTE_ARRAY : Encoding::PLAIN;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
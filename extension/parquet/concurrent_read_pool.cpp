@@ -0,0 +1,193 @@
+#include "concurrent_read_pool.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/parallel/task_scheduler.hpp"
+#endif
+
+#include <algorithm>
+
+namespace duckdb {
+
+struct ConcurrentReadPool::ReadBatch {
+	ReadBatch(ConcurrentReader &reader, FileHandle &handle, const vector<ReadPart> &parts, idx_t max_readers)
+	    : reader(reader), path(handle.path), flags(FileFlags::FILE_FLAGS_READ), parts(parts), next_part(0),
+	      max_readers(max_readers) {
+		if (!handle.OnDiskFile()) {
+			// the reads are buffered by the requester, the file system should not buffer them as well
+			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+		}
+	}
+
+	ConcurrentReader &reader;
+	const string &path;
+	//! The flags that the pool threads open the file with
+	uint8_t flags;
+	const vector<ReadPart> &parts;
+	//! The next part that no thread is reading yet
+	atomic<idx_t> next_part;
+	//! The number of pool threads that may read parts of this batch
+	idx_t max_readers;
+	//! The number of pool threads that read parts of this batch
+	idx_t readers = 0;
+	//! The first error a pool thread ran into
+	std::exception_ptr error;
+};
+
+ConcurrentReadPool::ConcurrentReadPool() {
+}
+
+ConcurrentReadPool::~ConcurrentReadPool() {
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+	}
+	work_available.notify_all();
+	for (auto &pool_thread : threads) {
+		pool_thread.join();
+	}
+}
+
+shared_ptr<ConcurrentReadPool> ConcurrentReadPool::Get(ClientContext &context) {
+	return ObjectCache::GetObjectCache(context).GetOrCreate<ConcurrentReadPool>(ConcurrentReadPool::ObjectType());
+}
+
+void ConcurrentReadPool::StartThreads(idx_t thread_count) {
+	while (threads.size() < thread_count) {
+		try {
+			threads.emplace_back(&ConcurrentReadPool::WorkerThread, this);
+		} catch (std::exception &ex) {
+			// we could not start another thread: the parts are read by the threads we have
+			break;
+		}
+	}
+}
+
+ConcurrentReadPool::ReadBatch *ConcurrentReadPool::GetBatch() {
+	for (idx_t batch_idx = 0; batch_idx < batches.size();) {
+		auto &batch = *batches[batch_idx];
+		if (batch.next_part >= batch.parts.size()) {
+			// every part of this batch is being read already
+			batches.erase(batches.begin() + batch_idx);
+			continue;
+		}
+		if (batch.readers < batch.max_readers) {
+			return &batch;
+		}
+		batch_idx++;
+	}
+	return nullptr;
+}
+
+void ConcurrentReadPool::ReadParts(ReadBatch &batch, FileHandle &handle) {
+	for (idx_t part_idx = batch.next_part++; part_idx < batch.parts.size(); part_idx = batch.next_part++) {
+		auto &part = batch.parts[part_idx];
+		handle.Read(part.data, part.size, part.location);
+	}
+}
+
+void ConcurrentReadPool::WorkerThread() {
+	unique_lock<mutex> guard(lock);
+	while (true) {
+		ReadBatch *batch = nullptr;
+		work_available.wait(guard, [&]() { return shutdown || (batch = GetBatch()) != nullptr; });
+		if (shutdown) {
+			break;
+		}
+		batch->readers++;
+		guard.unlock();
+
+		std::exception_ptr error;
+		try {
+			auto file_handle = batch->reader.GetHandle(batch->path, batch->flags);
+			ReadParts(*batch, *file_handle);
+			batch->reader.ReturnHandle(std::move(file_handle));
+		} catch (...) {
+			error = std::current_exception();
+			// stop the other threads from starting on the remaining parts
+			batch->next_part = batch->parts.size();
+		}
+
+		guard.lock();
+		if (error && !batch->error) {
+			batch->error = error;
+		}
+		batch->readers--;
+		batch_done.notify_all();
+	}
+}
+
+void ConcurrentReadPool::Read(ConcurrentReader &reader, FileHandle &handle, const vector<ReadPart> &parts,
+                              idx_t max_threads) {
+	if (parts.size() <= 1 || max_threads <= 1) {
+		for (auto &part : parts) {
+			handle.Read(part.data, part.size, part.location);
+		}
+		return;
+	}
+	ReadBatch batch(reader, handle, parts, MinValue<idx_t>(max_threads, parts.size()) - 1);
+	{
+		lock_guard<mutex> guard(lock);
+		// the thread that requests the read is one of the threads that reads the parts
+		StartThreads(max_threads - 1);
+		batches.push_back(&batch);
+	}
+	work_available.notify_all();
+
+	std::exception_ptr error;
+	try {
+		ReadParts(batch, handle);
+	} catch (...) {
+		error = std::current_exception();
+		batch.next_part = parts.size();
+	}
+
+	// wait for the pool threads that are still reading parts of the batch
+	unique_lock<mutex> guard(lock);
+	auto entry = std::find(batches.begin(), batches.end(), &batch);
+	if (entry != batches.end()) {
+		batches.erase(entry);
+	}
+	batch_done.wait(guard, [&]() { return batch.readers == 0; });
+	if (!error) {
+		error = batch.error;
+	}
+	guard.unlock();
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+ConcurrentReader::ConcurrentReader(ClientContext &context)
+    : pool(ConcurrentReadPool::Get(context)), fs(FileSystem::GetFileSystem(context)),
+      max_threads(TaskScheduler::GetScheduler(context).NumberOfThreads()) {
+}
+
+void ConcurrentReader::Read(FileHandle &handle, const vector<ReadPart> &parts) {
+	pool->Read(*this, handle, parts, max_threads);
+}
+
+unique_ptr<FileHandle> ConcurrentReader::GetHandle(const string &path, uint8_t flags) {
+	{
+		lock_guard<mutex> guard(lock);
+		for (idx_t handle_idx = idle_handles.size(); handle_idx > 0; handle_idx--) {
+			auto &idle_handle = idle_handles[handle_idx - 1];
+			if (idle_handle->path == path) {
+				auto result = std::move(idle_handle);
+				idle_handles.erase(idle_handles.begin() + handle_idx - 1);
+				return result;
+			}
+		}
+	}
+	return fs.OpenFile(path, flags);
+}
+
+void ConcurrentReader::ReturnHandle(unique_ptr<FileHandle> handle) {
+	lock_guard<mutex> guard(lock);
+	if (idle_handles.size() >= max_threads * MAX_IDLE_HANDLES_PER_THREAD) {
+		// close the handle that was used least recently
+		idle_handles.erase(idle_handles.begin());
+	}
+	idle_handles.push_back(std::move(handle));
+}
+
+} // namespace duckdb
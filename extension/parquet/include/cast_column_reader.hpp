@@ -42,6 +42,10 @@ public:
 		return child_reader->FileOffset();
 	}
 
+	bool CanSeekToRow(const vector<ColumnChunk> &columns) override {
+		return child_reader->CanSeekToRow(columns);
+	}
+
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
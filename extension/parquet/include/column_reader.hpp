@@ -34,6 +34,7 @@ using duckdb_apache::thrift::protocol::TProtocol;
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
@@ -66,12 +67,22 @@ public:
 	virtual idx_t FileOffset() const;
 	virtual uint64_t TotalCompressedSize();
 	virtual idx_t GroupRowsAvailable();
+	//! Whether the column chunks of the row group have an offset index that allows starting the read at any row
+	virtual bool CanSeekToRow(const vector<ColumnChunk> &columns);
+	//! Allows Read() to return dictionary vectors, which is only done for columns that are read into the result chunk
+	void AllowDictionaryOutput() {
+		allow_dictionary_output = true;
+	}
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
+	//! Returns the offset index (the locations of the data pages) of the current column chunk, or nullptr if the
+	//! column chunk has no offset index or the reader cannot skip pages. The offset index is loaded on first use.
+	const OffsetIndex *GetOffsetIndex();
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
@@ -99,6 +110,8 @@ protected:
 	virtual void Dictionary(shared_ptr<ResizeableBuffer> dictionary_data, idx_t num_entries);
 	virtual void Offsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, parquet_filter_t &filter,
 	                     idx_t result_offset, Vector &result);
+	// emits the values as a dictionary vector that references the dictionary, returns false if not supported
+	virtual bool DictionaryOffsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result);
 
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
@@ -133,6 +146,7 @@ protected:
 	idx_t byte_array_count = 0;
 
 	idx_t pending_skips = 0;
+	bool allow_dictionary_output = false;
 
 	virtual void ResetPage();
 
@@ -142,7 +156,9 @@ private:
 	void PrepareRead(parquet_filter_t &filter);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
+	void PrepareByteStreamSplit(ResizeableBuffer &buffer);
 	void PreparePageV2(PageHeader &page_hdr);
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -153,6 +169,9 @@ private:
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
 
+	bool offset_index_loaded = false;
+	duckdb::unique_ptr<OffsetIndex> offset_index;
+
 	shared_ptr<ResizeableBuffer> block;
 
 	ResizeableBuffer compressed_buffer;
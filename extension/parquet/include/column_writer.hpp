@@ -46,6 +46,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of another state of the same type (e.g. the statistics of a single page) into this one
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
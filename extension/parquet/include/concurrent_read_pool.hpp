@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// concurrent_read_pool.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#endif
+
+#include <condition_variable>
+#include <exception>
+
+namespace duckdb {
+class ConcurrentReader;
+
+// A part of a file that is read with a single request
+struct ReadPart {
+	data_ptr_t data;
+	idx_t location;
+	uint64_t size;
+};
+
+//! ConcurrentReadPool holds the threads that read parts of files with concurrent requests, so that the latency of the
+//! requests overlaps. A single pool is kept per database in the object cache, and is shared by all scans. The pool
+//! threads are started when they are first needed, and there are never more of them than the threads setting.
+class ConcurrentReadPool : public ObjectCacheEntry {
+public:
+	ConcurrentReadPool();
+	~ConcurrentReadPool() override;
+
+	//! Returns the pool of the database of the context, creating it if there is none yet
+	static shared_ptr<ConcurrentReadPool> Get(ClientContext &context);
+
+	static string ObjectType() {
+		return "parquet_concurrent_read_pool";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! Reads the parts of the file of the handle with at most max_threads threads, including the calling thread, and
+	//! returns once all of them are read. The pool threads read through the handles of the reader.
+	void Read(ConcurrentReader &reader, FileHandle &handle, const vector<ReadPart> &parts, idx_t max_threads);
+
+private:
+	struct ReadBatch;
+
+	void StartThreads(idx_t thread_count);
+	void WorkerThread();
+	//! Returns a batch that has parts left and that may be read by another pool thread, or nullptr if there is none
+	ReadBatch *GetBatch();
+	//! Reads parts of the batch through the handle until no parts are left
+	static void ReadParts(ReadBatch &batch, FileHandle &handle);
+
+private:
+	mutex lock;
+	//! Signalled when a batch is added or the pool is shut down
+	std::condition_variable work_available;
+	//! Signalled when a pool thread stops reading parts of a batch
+	std::condition_variable batch_done;
+	//! The batches that may have parts that no thread is reading yet
+	vector<ReadBatch *> batches;
+	vector<thread> threads;
+	bool shutdown = false;
+};
+
+//! ConcurrentReader reads parts of files through the pool of the database, and is shared by all threads of a scan.
+//! File handles cannot be used concurrently, so the pool threads read through handles of their own. These are opened
+//! through the file system of the client that runs the scan, and are kept open until the scan is done, so that later
+//! reads reuse their connections.
+class ConcurrentReader {
+public:
+	//! The number of idle file handles that are kept open per thread
+	static constexpr idx_t MAX_IDLE_HANDLES_PER_THREAD = 4;
+
+	explicit ConcurrentReader(ClientContext &context);
+
+	//! Reads the parts of the file of the handle, and returns once all of them are read
+	void Read(FileHandle &handle, const vector<ReadPart> &parts);
+
+	//! Returns an idle handle to the file, opening one if there is none
+	unique_ptr<FileHandle> GetHandle(const string &path, uint8_t flags);
+	//! Hands back a handle that is no longer used, so that it can be reused by a later read
+	void ReturnHandle(unique_ptr<FileHandle> handle);
+
+private:
+	shared_ptr<ConcurrentReadPool> pool;
+	FileSystem &fs;
+	//! The number of threads, including the requesting thread, that read the parts of a single read
+	idx_t max_threads;
+
+	mutex lock;
+	//! The handles that are not used by a pool thread, the least recently used handle first
+	vector<unique_ptr<FileHandle>> idle_handles;
+};
+
+} // namespace duckdb
@@ -38,6 +38,11 @@ public:
 		return child_column_reader->TotalCompressedSize();
 	}
 
+	bool CanSeekToRow(const vector<ColumnChunk> &columns) override {
+		// the pages of list entries do not start at row boundaries
+		return false;
+	}
+
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_column_reader->RegisterPrefetch(transport, allow_merge);
 	}
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/value.hpp"
+#endif
+#include "parquet_types.h"
+#include "thrift/protocol/TProtocol.h"
+
+namespace duckdb {
+
+//! ParquetBloomFilter is a split block Bloom filter as defined by the Parquet format. The filter consists of blocks
+//! of 256 bits, every value sets one bit in each of the eight 32-bit words of a single block. Values are hashed with
+//! XXH64 over their plain encoding.
+class ParquetBloomFilter {
+public:
+	//! The number of bytes in a block
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The minimum and maximum size of a filter in bytes
+	static constexpr const idx_t MINIMUM_BYTES = BLOCK_SIZE;
+	static constexpr const idx_t MAXIMUM_BYTES = 1048576;
+	//! The false positive probability we size filters for
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+	//! Returns the size (in bytes) of a filter that can hold the given number of distinct values
+	static idx_t OptimalNumBytes(idx_t distinct_values, double false_positive_ratio = DEFAULT_FALSE_POSITIVE_RATIO);
+	//! Hashes the plain encoding of a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	//! Whether or not a lookup in the filter of the column can prove that a value does not occur in the column
+	static bool CanExcludeValues(const duckdb_parquet::format::SchemaElement &schema);
+	//! Hashes a constant of the given type the same way the value would have been hashed when writing the column
+	//! described by the schema element. Returns false if the value cannot be hashed.
+	static bool TryHashConstant(const Value &constant, const duckdb_parquet::format::SchemaElement &schema,
+	                            uint64_t &result);
+
+	void Insert(uint64_t hash);
+	bool Contains(uint64_t hash) const;
+
+	idx_t SizeInBytes() const {
+		return blocks.size() * sizeof(uint32_t);
+	}
+
+	//! Writes the filter header using the protocol, followed by the bitset
+	void Write(duckdb_apache::thrift::protocol::TProtocol &protocol) const;
+	//! Reads a filter, or returns nullptr if the filter uses an algorithm, hash or compression we do not support
+	static unique_ptr<ParquetBloomFilter> Read(duckdb_apache::thrift::protocol::TProtocol &protocol);
+
+private:
+	//! The bitset, stored as 32-bit words
+	vector<uint32_t> blocks;
+};
+
+//! ParquetBloomFilterBuilder collects the hashes of the values of a column chunk, so the filter can be sized for the
+//! number of distinct values instead of the number of values
+class ParquetBloomFilterBuilder {
+public:
+	//! The number of hashes we collect before removing duplicates for the first time
+	static constexpr const idx_t INITIAL_HASH_COUNT = 1024;
+
+public:
+	explicit ParquetBloomFilterBuilder(double false_positive_ratio = ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+
+	void Insert(uint64_t hash);
+	//! Creates the filter that holds all inserted hashes
+	unique_ptr<ParquetBloomFilter> Finalize();
+
+private:
+	void Deduplicate();
+
+private:
+	double false_positive_ratio;
+	//! The number of distinct values for which a filter of the maximum size is needed
+	idx_t max_distinct_values;
+	//! The hashes inserted so far, until we know the filter needs its maximum size
+	vector<uint64_t> hashes;
+	//! The number of hashes at which duplicates are removed again
+	idx_t next_deduplicate;
+	//! The filter of the maximum size, once the hashes contain enough distinct values
+	unique_ptr<ParquetBloomFilter> filter;
+};
+
+} // namespace duckdb
@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/serializer.hpp"
+#endif
+
+#include <type_traits>
+
+namespace duckdb {
+
+//! DbpEncoder writes integers using the DELTA_BINARY_PACKED encoding. After a header with the first value, the deltas
+//! between consecutive values are written in blocks. Every block stores its minimum delta, followed by the deltas
+//! relative to that minimum, bit-packed in miniblocks that each have their own bit width.
+class DbpEncoder {
+public:
+	static constexpr const idx_t BLOCK_SIZE = 128;
+	static constexpr const idx_t MINIBLOCKS_PER_BLOCK = 4;
+	static constexpr const idx_t VALUES_PER_MINIBLOCK = BLOCK_SIZE / MINIBLOCKS_PER_BLOCK;
+
+public:
+	//! Encodes a set of INT32 or INT64 values
+	template <class T>
+	static void Encode(Serializer &writer, const T *values, idx_t count) {
+		using UNSIGNED = typename std::make_unsigned<T>::type;
+
+		// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+		WriteVarint(writer, BLOCK_SIZE);
+		WriteVarint(writer, MINIBLOCKS_PER_BLOCK);
+		WriteVarint(writer, count);
+		WriteZigzag(writer, count == 0 ? 0 : int64_t(values[0]));
+
+		T block_deltas[BLOCK_SIZE];
+		uint64_t packed_deltas[BLOCK_SIZE];
+		for (idx_t block_start = 1; block_start < count; block_start += BLOCK_SIZE) {
+			auto block_count = MinValue<idx_t>(BLOCK_SIZE, count - block_start);
+			T min_delta = NumericLimits<T>::Maximum();
+			for (idx_t i = 0; i < block_count; i++) {
+				// the deltas wrap around on overflow
+				auto delta = T(UNSIGNED(values[block_start + i]) - UNSIGNED(values[block_start + i - 1]));
+				block_deltas[i] = delta;
+				min_delta = MinValue<T>(min_delta, delta);
+			}
+			for (idx_t i = 0; i < BLOCK_SIZE; i++) {
+				// the last miniblock is padded with zeroes
+				packed_deltas[i] = i < block_count ? UNSIGNED(UNSIGNED(block_deltas[i]) - UNSIGNED(min_delta)) : 0;
+			}
+			WriteZigzag(writer, int64_t(min_delta));
+
+			// miniblocks without any values get a bit width of zero and are not written
+			uint8_t bit_widths[MINIBLOCKS_PER_BLOCK];
+			for (idx_t miniblock_idx = 0; miniblock_idx < MINIBLOCKS_PER_BLOCK; miniblock_idx++) {
+				uint64_t max_delta = 0;
+				auto miniblock_start = miniblock_idx * VALUES_PER_MINIBLOCK;
+				for (idx_t i = miniblock_start; i < miniblock_start + VALUES_PER_MINIBLOCK; i++) {
+					max_delta |= packed_deltas[i];
+				}
+				bit_widths[miniblock_idx] = BitWidth(max_delta);
+			}
+			writer.WriteData(bit_widths, MINIBLOCKS_PER_BLOCK);
+			for (idx_t miniblock_idx = 0; miniblock_idx < MINIBLOCKS_PER_BLOCK; miniblock_idx++) {
+				auto miniblock_start = miniblock_idx * VALUES_PER_MINIBLOCK;
+				if (miniblock_start >= block_count) {
+					break;
+				}
+				BitPack(writer, packed_deltas + miniblock_start, VALUES_PER_MINIBLOCK, bit_widths[miniblock_idx]);
+			}
+		}
+	}
+
+	//! The number of bits required to store the value
+	static uint8_t BitWidth(uint64_t value);
+
+private:
+	static void WriteVarint(Serializer &writer, uint64_t value);
+	static void WriteZigzag(Serializer &writer, int64_t value);
+	//! Bit-packs the values, starting from the least significant bit of every byte
+	static void BitPack(Serializer &writer, const uint64_t *values, idx_t count, uint8_t bit_width);
+};
+
+} // namespace duckdb
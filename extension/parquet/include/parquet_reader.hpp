@@ -20,6 +20,8 @@
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/multi_file_reader_options.hpp"
 #include "duckdb/common/multi_file_reader.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/limits.hpp"
 #endif
 #include "column_reader.hpp"
 #include "parquet_file_metadata_cache.hpp"
@@ -39,6 +41,8 @@ namespace duckdb {
 class Allocator;
 class ClientContext;
 class BaseStatistics;
+class ConcurrentReader;
+class TableFilter;
 class TableFilterSet;
 
 struct ParquetReaderPrefetchConfig {
@@ -62,6 +66,19 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+	//! Whether files that are on disk are prefetched as well (the "prefetch_all_parquet_files" setting)
+	bool prefetch_all_files = false;
+	//! Reads prefetched ranges concurrently through the read pool of the database, shared by all threads of the scan
+	shared_ptr<ConcurrentReader> concurrent_reader;
+
+	//! The row ranges [start, end) of the current row group that may contain matches according to the page index.
+	//! Empty if the page index did not exclude any rows.
+	vector<pair<idx_t, idx_t>> selected_ranges;
+	idx_t current_range = 0;
+
+	//! The rows [start, end) of the row group that are scanned, a row group can be divided over multiple scans
+	idx_t group_row_start = 0;
+	idx_t group_row_end = NumericLimits<idx_t>::Maximum();
 };
 
 struct ParquetOptions {
@@ -100,6 +117,8 @@ public:
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	//! Whether the scan of the given row group can be divided into row ranges that are scanned independently
+	bool CanSplitRowGroup(ParquetReaderScanState &state, idx_t group_idx);
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -133,6 +152,11 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	// Uses the page index of the filtered columns to determine which rows of the current row group can be skipped
+	void PrepareRowGroupPageSelection(ParquetReaderScanState &state);
+	// Checks the Bloom filter of a column chunk of the current row group against the filter on the column
+	bool BloomFilterExcludesGroup(ParquetReaderScanState &state, ColumnReader &column_reader,
+	                              const TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
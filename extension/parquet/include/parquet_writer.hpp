@@ -13,12 +13,15 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #endif
 
 #include "parquet_types.h"
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
 
 namespace duckdb {
@@ -30,10 +33,29 @@ struct PreparedRowGroup {
 	vector<duckdb::unique_ptr<ColumnWriterState>> states;
 };
 
+//! The page index of a column chunk, which is written at the end of the file
+struct ParquetPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The column index is only written if we have statistics for every page
+	bool has_column_index;
+	duckdb_parquet::format::ColumnIndex column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
 class ParquetWriter {
+public:
+	//! We limit the uncompressed page size to 100MB
+	// The max size in Parquet is 2GB, but we choose a more conservative limit
+	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! The page size we use when writing a page index, small pages allow readers to skip more data
+	static constexpr const idx_t DEFAULT_PAGE_INDEX_PAGE_SIZE = 1048576;
+
 public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
-	              duckdb_parquet::format::CompressionCodec::type codec);
+	              duckdb_parquet::format::CompressionCodec::type codec,
+	              idx_t page_size = MAX_UNCOMPRESSED_PAGE_SIZE, bool write_page_index = false,
+	              const vector<idx_t> &bloom_filter_columns = vector<idx_t>());
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -56,12 +78,33 @@ public:
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
+	idx_t GetPageSize() {
+		return page_size;
+	}
+	bool WritePageIndex() {
+		return write_page_index;
+	}
+	bool HasBloomFilter(idx_t schema_idx) {
+		return bloom_filter_schemas.find(schema_idx) != bloom_filter_schemas.end();
+	}
+
+	//! Whether or not we can write a Bloom filter for a column of the given type
+	static bool SupportsBloomFilter(const LogicalType &type);
+
+	//! Registers the page index of a column chunk of the row group that is currently being flushed
+	void AddPageIndex(idx_t column_idx, unique_ptr<ParquetPageIndex> page_index);
+	//! Registers the Bloom filter of a column chunk of the row group that is currently being flushed
+	void AddBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
 
 private:
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec;
+	idx_t page_size;
+	bool write_page_index;
+	//! The schema indexes of the columns for which we write Bloom filters
+	unordered_set<idx_t> bloom_filter_schemas;
 
 	duckdb::unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -69,6 +112,10 @@ private:
 	std::mutex lock;
 
 	vector<duckdb::unique_ptr<ColumnWriter>> column_writers;
+	//! The page indexes of all column chunks written so far
+	vector<unique_ptr<ParquetPageIndex>> page_indexes;
+	//! The Bloom filters of the row group that is being flushed, they are written after the row group
+	vector<pair<idx_t, unique_ptr<ParquetBloomFilter>>> bloom_filters;
 };
 
 } // namespace duckdb
@@ -45,6 +45,9 @@ public:
 	idx_t FileOffset() const override {
 		return 0;
 	}
+	bool CanSeekToRow(const vector<ColumnChunk> &columns) override {
+		return true;
+	}
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 	}
 
@@ -28,7 +28,9 @@ public:
 	StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t schema_idx_p,
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
-	duckdb::unique_ptr<string_t[]> dict_strings;
+	//! The dictionary values, followed by a NULL entry that NULL values refer to when emitting dictionary vectors
+	duckdb::unique_ptr<Vector> dictionary;
+	idx_t dictionary_size = 0;
 	idx_t fixed_width_string_length;
 	idx_t delta_offset = 0;
 
@@ -43,6 +45,7 @@ public:
 	uint32_t VerifyString(const char *str_data, uint32_t str_len);
 
 protected:
+	bool DictionaryOffsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) override;
 	void DictReference(Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
 };
@@ -35,6 +35,7 @@ public:
 	void Skip(idx_t num_values) override;
 	idx_t GroupRowsAvailable() override;
 	uint64_t TotalCompressedSize() override;
+	bool CanSeekToRow(const vector<ColumnChunk> &columns) override;
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override;
 };
 
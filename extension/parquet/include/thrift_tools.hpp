@@ -3,10 +3,12 @@
 #include "thrift/protocol/TCompactProtocol.h"
 #include "thrift/transport/TBufferTransports.h"
 
+#include "concurrent_read_pool.hpp"
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #endif
 
 namespace duckdb {
@@ -51,7 +53,12 @@ struct ReadHeadComparator {
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	// When reading through a file system with a high latency per request, the read heads are split into parts of at
+	// most this size which are read concurrently by the read pool
+	static constexpr uint64_t CONCURRENT_READ_PART_SIZE = 1 << 22; // 4 MiB
+
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, optional_ptr<ConcurrentReader> concurrent_reader)
+	    : allocator(allocator), handle(handle), concurrent_reader(concurrent_reader) {
 	}
 
 	// The list of read heads
@@ -61,6 +68,8 @@ struct ReadAheadBuffer {
 
 	Allocator &allocator;
 	FileHandle &handle;
+	// The reader that reads the parts of the read heads concurrently, if enabled
+	optional_ptr<ConcurrentReader> concurrent_reader;
 
 	idx_t total_size = 0;
 
@@ -105,6 +114,7 @@ struct ReadAheadBuffer {
 
 	// Prefetch all read heads
 	void Prefetch() {
+		vector<ReadPart> parts;
 		for (auto &read_head : read_heads) {
 			read_head.Allocate(allocator);
 
@@ -112,9 +122,19 @@ struct ReadAheadBuffer {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			if (!concurrent_reader) {
+				handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			} else {
+				for (uint64_t offset = 0; offset < read_head.size; offset += CONCURRENT_READ_PART_SIZE) {
+					auto part_size = MinValue<uint64_t>(CONCURRENT_READ_PART_SIZE, read_head.size - offset);
+					parts.push_back(ReadPart {read_head.data.get() + offset, read_head.location + offset, part_size});
+				}
+			}
 			read_head.data_isset = true;
 		}
+		if (!parts.empty()) {
+			concurrent_reader->Read(handle, parts);
+		}
 	}
 };
 
@@ -122,8 +142,9 @@ class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTra
 public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
-	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p,
+	                    optional_ptr<ConcurrentReader> concurrent_reader = nullptr)
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p, concurrent_reader),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
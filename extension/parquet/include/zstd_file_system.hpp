@@ -26,6 +26,11 @@ public:
 	duckdb::unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	bool SupportsBlockDecompression(CompressedFile &file) override;
+	CompressedBlockResult FindBlock(CompressedFile &file, idx_t file_offset, const_data_ptr_t data, idx_t size,
+	                                CompressedBlock &result) override;
+	void DecompressBlock(const_data_ptr_t data, const CompressedBlock &block, data_ptr_t out) override;
 };
 
 } // namespace duckdb
@@ -15,6 +15,7 @@
 #include <vector>
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/field_writer.hpp"
@@ -35,6 +36,7 @@
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/main/extension_util.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #endif
 
 namespace duckdb {
@@ -76,6 +78,9 @@ struct ParquetReadLocalState : public LocalTableFunctionState {
 };
 
 struct ParquetReadGlobalState : public GlobalTableFunctionState {
+	//! Row groups are only divided over multiple threads if every thread scans at least this many rows
+	static constexpr const idx_t MIN_ROWS_PER_SPLIT = 16 * STANDARD_VECTOR_SIZE;
+
 	mutex lock;
 
 	//! The initial reader from the bind phase
@@ -95,8 +100,17 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	idx_t row_group_index;
 	//! Batch index of the next row group to be scanned
 	idx_t batch_index;
+	//! The scans that the current row group is divided into, and the index of the next one
+	idx_t row_group_splits = 1;
+	idx_t row_group_split = 0;
+	//! The amount of rows of the current row group that every scan reads
+	idx_t rows_per_split = 0;
 
 	idx_t max_threads;
+	//! Whether files on disk are prefetched like remote files
+	bool prefetch_all_files = false;
+	//! Reads prefetched ranges concurrently through the read pool of the database, shared by all threads of the scan
+	shared_ptr<ConcurrentReader> concurrent_reader;
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
 	vector<column_t> column_ids;
@@ -116,6 +130,12 @@ struct ParquetWriteBindData : public TableFunctionData {
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec = duckdb_parquet::format::CompressionCodec::SNAPPY;
 	idx_t row_group_size = RowGroup::ROW_GROUP_SIZE;
+	//! The (estimated) uncompressed size of data pages, if not set we write a single page per column chunk unless we
+	//! write a page index
+	idx_t page_size = DConstants::INVALID_INDEX;
+	bool write_page_index = false;
+	//! The columns for which we write Bloom filters
+	vector<idx_t> bloom_filter_columns;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -335,6 +355,8 @@ public:
 		if (input.CanRemoveFilterColumns()) {
 			result->all_columns.Initialize(context.client, gstate.scanned_types);
 		}
+		result->scan_state.prefetch_all_files = gstate.prefetch_all_files;
+		result->scan_state.concurrent_reader = gstate.concurrent_reader;
 		if (!ParquetParallelStateNext(context.client, bind_data, *result, gstate)) {
 			return nullptr;
 		}
@@ -381,6 +403,11 @@ public:
 		result->file_index = 0;
 		result->batch_index = 0;
 		result->max_threads = ParquetScanMaxThreads(context, input.bind_data.get());
+		Value prefetch_all_files;
+		if (context.TryGetCurrentSetting("prefetch_all_parquet_files", prefetch_all_files)) {
+			result->prefetch_all_files = prefetch_all_files.GetValue<bool>();
+		}
+		result->concurrent_reader = make_shared<ConcurrentReader>(context);
 		if (input.CanRemoveFilterColumns()) {
 			result->projection_ids = input.projection_ids;
 			const auto table_types = bind_data.types;
@@ -458,7 +485,29 @@ public:
 
 	static idx_t ParquetScanMaxThreads(ClientContext &context, const FunctionData *bind_data) {
 		auto &data = bind_data->Cast<ParquetReadBindData>();
-		return data.initial_file_row_groups * data.files.size();
+		auto row_groups = data.initial_file_row_groups * data.files.size();
+		// large row groups can be divided over multiple threads
+		auto max_splits = data.initial_file_cardinality * data.files.size() / ParquetReadGlobalState::MIN_ROWS_PER_SPLIT;
+		auto thread_count = idx_t(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		return MaxValue<idx_t>(row_groups, MinValue<idx_t>(max_splits, thread_count));
+	}
+
+	//! Returns the amount of scans that a row group is divided into, which lets few row groups occupy all threads
+	static idx_t GetRowGroupSplits(ClientContext &context, const ParquetReadBindData &bind_data,
+	                               ParquetReadLocalState &scan_data, idx_t group_idx) {
+		auto &reader = *scan_data.reader;
+		auto row_groups = reader.NumRowGroups() * bind_data.files.size();
+		auto thread_count = idx_t(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		if (row_groups >= thread_count) {
+			return 1;
+		}
+		auto group_rows = idx_t(reader.GetFileMetadata()->row_groups[group_idx].num_rows);
+		auto splits = MinValue<idx_t>((thread_count + row_groups - 1) / row_groups,
+		                              group_rows / ParquetReadGlobalState::MIN_ROWS_PER_SPLIT);
+		if (splits <= 1 || !reader.CanSplitRowGroup(scan_data.scan_state, group_idx)) {
+			return 1;
+		}
+		return splits;
 	}
 
 	// This function looks for the next available row group. If not available, it will open files from bind_data.files
@@ -482,12 +531,34 @@ public:
 				if (parallel_state.row_group_index <
 				    parallel_state.readers[parallel_state.file_index]->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
+					auto group_idx = parallel_state.row_group_index;
 					scan_data.reader = parallel_state.readers[parallel_state.file_index];
-					vector<idx_t> group_indexes {parallel_state.row_group_index};
+					vector<idx_t> group_indexes {group_idx};
 					scan_data.reader->InitializeScan(scan_data.scan_state, group_indexes);
+					if (parallel_state.row_group_split == 0) {
+						// first scan of this row group: decide how many scans it is divided into
+						auto splits = GetRowGroupSplits(context, bind_data, scan_data, group_idx);
+						auto group_rows = idx_t(scan_data.reader->GetFileMetadata()->row_groups[group_idx].num_rows);
+						// the scans start at vector boundaries
+						auto rows_per_split =
+						    AlignValue<idx_t, STANDARD_VECTOR_SIZE>((group_rows + splits - 1) / splits);
+						parallel_state.rows_per_split = rows_per_split;
+						parallel_state.row_group_splits =
+						    splits == 1 ? 1 : (group_rows + rows_per_split - 1) / rows_per_split;
+					}
+					if (parallel_state.row_group_splits > 1) {
+						auto split_start = parallel_state.row_group_split * parallel_state.rows_per_split;
+						scan_data.scan_state.group_row_start = split_start;
+						scan_data.scan_state.group_row_end = split_start + parallel_state.rows_per_split;
+					}
+					// every scan gets its own batch index, so the results of a divided row group stay in order
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
+					parallel_state.row_group_split++;
+					if (parallel_state.row_group_split >= parallel_state.row_group_splits) {
+						parallel_state.row_group_index++;
+						parallel_state.row_group_split = 0;
+					}
 					return true;
 				} else {
 					// Set state to the next file
@@ -592,6 +663,28 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info
 		auto loption = StringUtil::Lower(option.first);
 		if (loption == "row_group_size" || loption == "chunk_size") {
 			bind_data->row_group_size = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "page_size") {
+			auto page_size = option.second[0].GetValue<uint64_t>();
+			if (page_size == 0 || page_size > ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE) {
+				throw BinderException("PAGE_SIZE must be between 1 and %llu bytes",
+				                      ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE);
+			}
+			bind_data->page_size = page_size;
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index =
+			    option.second.empty() || option.second[0].CastAs(context, LogicalType::BOOLEAN).GetValue<bool>();
+		} else if (loption == "bloom_filter_columns") {
+			auto columns = ParseColumnList(ConvertVectorToValue(option.second), names, loption);
+			for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+				if (!columns[col_idx]) {
+					continue;
+				}
+				if (!ParquetWriter::SupportsBloomFilter(sql_types[col_idx])) {
+					throw BinderException("Bloom filters are not supported for column \"%s\" of type %s",
+					                      names[col_idx], sql_types[col_idx].ToString());
+				}
+				bind_data->bloom_filter_columns.push_back(col_idx);
+			}
 		} else if (loption == "compression" || loption == "codec") {
 			if (!option.second.empty()) {
 				auto roption = StringUtil::Lower(option.second[0].ToString());
@@ -607,13 +700,22 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info
 				} else if (roption == "zstd") {
 					bind_data->codec = duckdb_parquet::format::CompressionCodec::ZSTD;
 					continue;
+				} else if (roption == "lz4" || roption == "lz4_raw") {
+					// the LZ4 codec is deprecated because its framing is ambiguous, we always write LZ4_RAW
+					bind_data->codec = duckdb_parquet::format::CompressionCodec::LZ4_RAW;
+					continue;
 				}
 			}
-			throw ParserException("Expected %s argument to be either [uncompressed, snappy, gzip or zstd]", loption);
+			throw ParserException("Expected %s argument to be either [uncompressed, snappy, gzip, zstd or lz4]",
+			                      loption);
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->page_size == DConstants::INVALID_INDEX) {
+		bind_data->page_size = bind_data->write_page_index ? ParquetWriter::DEFAULT_PAGE_INDEX_PAGE_SIZE
+		                                                   : ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE;
+	}
 	bind_data->sql_types = sql_types;
 	bind_data->column_names = names;
 	return std::move(bind_data);
@@ -625,8 +727,9 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &parquet_bind = bind_data.Cast<ParquetWriteBindData>();
 
 	auto &fs = FileSystem::GetFileSystem(context);
-	global_state->writer =
-	    make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec);
+	global_state->writer = make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
+	                                                parquet_bind.codec, parquet_bind.page_size,
+	                                                parquet_bind.write_page_index, parquet_bind.bloom_filter_columns);
 	return std::move(global_state);
 }
 
@@ -772,6 +875,9 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("prefetch_all_parquet_files",
+	                          "Use the prefetching mechanism of remote files for all Parquet files.",
+	                          LogicalType::BOOLEAN, Value(false));
 }
 
 std::string ParquetExtension::Name() {
@@ -0,0 +1,275 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+using duckdb_parquet::format::ConvertedType;
+using duckdb_parquet::format::SchemaElement;
+using duckdb_parquet::format::Type;
+
+namespace thrift_type = duckdb_apache::thrift::protocol;
+
+//! The salt values used to derive the bit that is set in each word of a block, as defined by the Parquet format
+static const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                              0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+static constexpr const idx_t WORDS_PER_BLOCK = 8;
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes >= BLOCK_SIZE && num_bytes % BLOCK_SIZE == 0);
+	blocks.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+idx_t ParquetBloomFilter::OptimalNumBytes(idx_t distinct_values, double false_positive_ratio) {
+	// the number of bits needed for a split block Bloom filter with the given false positive ratio
+	auto num_bits = -8.0 * double(distinct_values) / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	// the number of blocks has to be a power of two in most implementations
+	idx_t num_bytes = MINIMUM_BYTES;
+	while (num_bytes < MAXIMUM_BYTES && double(num_bytes * 8) < num_bits) {
+		num_bytes *= 2;
+	}
+	return num_bytes;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+template <class T>
+static uint64_t HashPlain(T value) {
+	return ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(T));
+}
+
+bool ParquetBloomFilter::CanExcludeValues(const SchemaElement &schema) {
+	switch (schema.type) {
+	case Type::FLOAT:
+	case Type::DOUBLE:
+		// floating point values are hashed by their bit pattern, but values that compare equal can have different
+		// bit patterns (0.0 and -0.0, or the different NaN encodings), so the filter cannot tell us a value is absent
+		return false;
+	default:
+		return true;
+	}
+}
+
+bool ParquetBloomFilter::TryHashConstant(const Value &constant, const SchemaElement &schema, uint64_t &result) {
+	if (constant.IsNull() || !CanExcludeValues(schema)) {
+		return false;
+	}
+	auto &type = constant.type();
+	switch (schema.type) {
+	case Type::INT32:
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			// unsigned values are stored as the bit pattern of their 32-bit representation
+			result = HashPlain<int32_t>(int32_t(constant.GetValue<int64_t>()));
+			return true;
+		case LogicalTypeId::DATE:
+			result = HashPlain<int32_t>(constant.GetValue<date_t>().days);
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+			result = HashPlain<int64_t>(constant.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			result = HashPlain<uint64_t>(constant.GetValue<uint64_t>());
+			return true;
+		case LogicalTypeId::TIMESTAMP:
+			if (!schema.__isset.converted_type || schema.converted_type != ConvertedType::TIMESTAMP_MICROS) {
+				return false;
+			}
+			result = HashPlain<int64_t>(constant.GetValue<timestamp_t>().value);
+			return true;
+		default:
+			return false;
+		}
+	case Type::BYTE_ARRAY: {
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		}
+		auto &str = StringValue::Get(constant);
+		result = Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+ParquetBloomFilterBuilder::ParquetBloomFilterBuilder(double false_positive_ratio)
+    : false_positive_ratio(false_positive_ratio), next_deduplicate(INITIAL_HASH_COUNT) {
+	// the number of distinct values at which the filter reaches its maximum size
+	auto max_bits = double(ParquetBloomFilter::MAXIMUM_BYTES * 8);
+	max_distinct_values = idx_t(max_bits * -std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0)) / 8.0);
+}
+
+void ParquetBloomFilterBuilder::Insert(uint64_t hash) {
+	if (filter) {
+		filter->Insert(hash);
+		return;
+	}
+	hashes.push_back(hash);
+	if (hashes.size() < next_deduplicate) {
+		return;
+	}
+	Deduplicate();
+	if (hashes.size() >= max_distinct_values) {
+		// the filter will have its maximum size: create it now, so we no longer have to keep the hashes around
+		filter = make_uniq<ParquetBloomFilter>(ParquetBloomFilter::MAXIMUM_BYTES);
+		for (auto &entry : hashes) {
+			filter->Insert(entry);
+		}
+		vector<uint64_t>().swap(hashes);
+		return;
+	}
+	next_deduplicate = MaxValue<idx_t>(hashes.size() * 2, INITIAL_HASH_COUNT);
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilterBuilder::Finalize() {
+	if (filter) {
+		return std::move(filter);
+	}
+	Deduplicate();
+	auto num_bytes = ParquetBloomFilter::OptimalNumBytes(hashes.size(), false_positive_ratio);
+	auto result = make_uniq<ParquetBloomFilter>(num_bytes);
+	for (auto &entry : hashes) {
+		result->Insert(entry);
+	}
+	vector<uint64_t>().swap(hashes);
+	return result;
+}
+
+void ParquetBloomFilterBuilder::Deduplicate() {
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block_count = blocks.size() / WORDS_PER_BLOCK;
+	auto block = blocks.data() + ((hash >> 32) * block_count >> 32) * WORDS_PER_BLOCK;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::Contains(uint64_t hash) const {
+	auto block_count = blocks.size() / WORDS_PER_BLOCK;
+	auto block = blocks.data() + ((hash >> 32) * block_count >> 32) * WORDS_PER_BLOCK;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Writes a union field that holds an empty struct, which is how the format encodes the algorithm, hash and
+//! compression of the filter
+static void WriteEmptyUnion(TProtocol &protocol, const char *name, int16_t field_id) {
+	protocol.writeFieldBegin(name, thrift_type::T_STRUCT, field_id);
+	protocol.writeStructBegin(name);
+	protocol.writeFieldBegin(name, thrift_type::T_STRUCT, 1);
+	protocol.writeStructBegin(name);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol) const {
+	// BloomFilterHeader
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", thrift_type::T_I32, 1);
+	protocol.writeI32(int32_t(SizeInBytes()));
+	protocol.writeFieldEnd();
+	// algorithm: BLOCK
+	WriteEmptyUnion(protocol, "algorithm", 2);
+	// hash: XXHASH
+	WriteEmptyUnion(protocol, "hash", 3);
+	// compression: UNCOMPRESSED
+	WriteEmptyUnion(protocol, "compression", 4);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+
+	// the bitset follows the header
+	protocol.getTransport()->write(const_data_ptr_cast(blocks.data()), SizeInBytes());
+}
+
+//! Reads a union that holds an empty struct, returns whether or not the first member of the union is set
+static bool ReadEmptyUnion(TProtocol &protocol) {
+	bool first_member = false;
+	std::string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == thrift_type::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == thrift_type::T_STRUCT) {
+			first_member = true;
+		}
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return first_member;
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &protocol) {
+	int32_t num_bytes = 0;
+	bool supported = true;
+	std::string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == thrift_type::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == thrift_type::T_I32) {
+			protocol.readI32(num_bytes);
+		} else if (field_id >= 2 && field_id <= 4 && field_type == thrift_type::T_STRUCT) {
+			// we only support the BLOCK algorithm, the XXHASH hash and UNCOMPRESSED filters
+			supported = ReadEmptyUnion(protocol) && supported;
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	if (!supported || num_bytes < int32_t(BLOCK_SIZE) || num_bytes % BLOCK_SIZE != 0 ||
+	    idx_t(num_bytes) > MAXIMUM_BYTES * 128) {
+		return nullptr;
+	}
+	auto result = make_uniq<ParquetBloomFilter>(num_bytes);
+	protocol.getTransport()->readAll(data_ptr_cast(result->blocks.data()), num_bytes);
+	return result;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "parquet_reader.hpp"
 #include "parquet_timestamp.hpp"
 #include "parquet_statistics.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "column_reader.hpp"
 
 #include "boolean_column_reader.hpp"
@@ -49,8 +50,9 @@ using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static duckdb::unique_ptr<duckdb_apache::thrift::protocol::TProtocol>
-CreateThriftProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode) {
-	auto transport = make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode);
+CreateThriftProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode,
+                     optional_ptr<ConcurrentReader> concurrent_reader = nullptr) {
+	auto transport = make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode, concurrent_reader);
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
@@ -381,6 +383,10 @@ unique_ptr<ColumnReader> ParquetReader::CreateReader() {
 		auto cast_reader = make_uniq<CastColumnReader>(std::move(child_reader), expected_type);
 		root_struct_reader.child_readers[column_idx] = std::move(cast_reader);
 	}
+	// top-level columns are read directly into the result chunk, so they can reference the dictionary of a page
+	for (auto &child_reader : root_struct_reader.child_readers) {
+		child_reader->AllowDictionaryOutput();
+	}
 	if (parquet_options.file_row_number) {
 		root_struct_reader.child_readers.push_back(
 		    make_uniq<RowNumberColumnReader>(*this, LogicalType::BIGINT, SchemaElement(), next_file_idx, 0, 0));
@@ -570,6 +576,91 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+//! Returns true if the Bloom filter of a column chunk proves that none of its values can pass the filter
+static bool BloomFilterExcludes(const TableFilter &filter, const ParquetBloomFilter &bloom_filter,
+                                const ColumnReader &column_reader) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    constant_filter.constant.type() != column_reader.Type()) {
+			return false;
+		}
+		uint64_t hash;
+		if (!ParquetBloomFilter::TryHashConstant(constant_filter.constant, column_reader.Schema(), hash)) {
+			return false;
+		}
+		return !bloom_filter.Contains(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterExcludes(*child_filter, bloom_filter, column_reader)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// an IN list is pushed down as a disjunction of equality comparisons
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterExcludes(*child_filter, bloom_filter, column_reader)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Whether or not the filter has an equality comparison that a Bloom filter can be used for
+static bool HasEqualityComparison(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND:
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (HasEqualityComparison(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	case TableFilterType::CONJUNCTION_OR:
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (!HasEqualityComparison(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool ParquetReader::BloomFilterExcludesGroup(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                             const TableFilter &filter) {
+	auto &group = GetGroup(state);
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset ||
+	    !HasEqualityComparison(filter) || !ParquetBloomFilter::CanExcludeValues(column_reader.Schema())) {
+		return false;
+	}
+	auto &meta_data = column_chunk.meta_data;
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	if (meta_data.__isset.bloom_filter_length && meta_data.bloom_filter_length > 0) {
+		trans.RegisterPrefetch(meta_data.bloom_filter_offset, meta_data.bloom_filter_length, false);
+	}
+	trans.SetLocation(meta_data.bloom_filter_offset);
+	auto bloom_filter = ParquetBloomFilter::Read(*state.thrift_file_proto);
+	if (!bloom_filter) {
+		return false;
+	}
+	return BloomFilterExcludes(filter, *bloom_filter, column_reader);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -587,6 +678,8 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			auto prune_result = filter.CheckStatistics(*stats);
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
+			} else if (BloomFilterExcludesGroup(state, *column_reader, filter)) {
+				skip_chunk = true;
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -600,6 +693,117 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+static vector<pair<idx_t, idx_t>> IntersectRanges(const vector<pair<idx_t, idx_t>> &left,
+                                                  const vector<pair<idx_t, idx_t>> &right) {
+	vector<pair<idx_t, idx_t>> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue<idx_t>(left[left_idx].first, right[right_idx].first);
+		auto end = MinValue<idx_t>(left[left_idx].second, right[right_idx].second);
+		if (start < end) {
+			result.emplace_back(start, end);
+		}
+		if (left[left_idx].second < right[right_idx].second) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::PrepareRowGroupPageSelection(ParquetReaderScanState &state) {
+	state.selected_ranges.clear();
+	state.current_range = 0;
+
+	auto &group = GetGroup(state);
+	auto group_rows = idx_t(group.num_rows);
+	if (state.group_offset >= group_rows) {
+		return;
+	}
+	if (!reader_data.filters && state.group_row_start == 0 && state.group_row_end >= group_rows) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+
+	// start from the part of the row group that is assigned to this scan
+	vector<pair<idx_t, idx_t>> selected_ranges;
+	auto range_end = MinValue<idx_t>(state.group_row_end, group_rows);
+	if (state.group_row_start < range_end) {
+		selected_ranges.emplace_back(state.group_row_start, range_end);
+	}
+	if (reader_data.filters) {
+		for (auto &filter_col : reader_data.filters->filters) {
+			auto &filter_entry = reader_data.filter_map[filter_col.first];
+			if (filter_entry.is_constant) {
+				continue;
+			}
+			auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+			auto offset_index = column_reader->GetOffsetIndex();
+			if (!offset_index) {
+				continue;
+			}
+			auto &column_chunk = group.columns[column_reader->FileIdx()];
+			if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.column_index_length ||
+			    column_chunk.column_index_length <= 0) {
+				continue;
+			}
+			trans.RegisterPrefetch(column_chunk.column_index_offset, column_chunk.column_index_length, false);
+			trans.SetLocation(column_chunk.column_index_offset);
+			duckdb_parquet::format::ColumnIndex column_index;
+			column_index.read(state.thrift_file_proto.get());
+
+			auto &pages = offset_index->page_locations;
+			auto page_count = pages.size();
+			if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+			    column_index.max_values.size() != page_count) {
+				continue;
+			}
+			auto has_null_counts = column_index.__isset.null_counts && column_index.null_counts.size() == page_count;
+
+			// collect the row ranges of all pages that might contain matches
+			vector<pair<idx_t, idx_t>> page_ranges;
+			for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+				auto page_start = idx_t(pages[page_idx].first_row_index);
+				auto page_end = page_idx + 1 < page_count ? idx_t(pages[page_idx + 1].first_row_index) : group_rows;
+				if (!column_index.null_pages[page_idx]) {
+					Statistics page_stats;
+					page_stats.__set_min_value(column_index.min_values[page_idx]);
+					page_stats.__set_max_value(column_index.max_values[page_idx]);
+					if (has_null_counts) {
+						page_stats.__set_null_count(column_index.null_counts[page_idx]);
+					}
+					auto stats = ParquetStatisticsUtils::TransformColumnStatistics(column_reader->Schema(),
+					                                                               column_reader->Type(), page_stats);
+					if (stats &&
+					    filter_col.second->CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+						continue;
+					}
+				}
+				if (!page_ranges.empty() && page_ranges.back().second == page_start) {
+					page_ranges.back().second = page_end;
+				} else {
+					page_ranges.emplace_back(page_start, page_end);
+				}
+			}
+			selected_ranges = IntersectRanges(selected_ranges, page_ranges);
+		}
+	}
+
+	if (selected_ranges.empty()) {
+		// no page can contain matches: skip the entire row group
+		state.group_offset = group_rows;
+		return;
+	}
+	if (selected_ranges.size() == 1 && selected_ranges[0].first == 0 && selected_ranges[0].second == group_rows) {
+		// no rows were excluded
+		return;
+	}
+	state.selected_ranges = std::move(selected_ranges);
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -608,26 +812,48 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+bool ParquetReader::CanSplitRowGroup(ParquetReaderScanState &state, idx_t group_idx) {
+	if (!file_handle->OnDiskFile() || state.prefetch_all_files) {
+		// prefetching scans prefetch entire column chunks, which would then be fetched by every scan of the row group
+		return false;
+	}
+	D_ASSERT(state.root_reader);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &columns = GetFileMetadata()->row_groups[group_idx].columns;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		if (!root_reader.GetChildReader(reader_data.column_ids[col_idx])->CanSeekToRow(columns)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
 	state.current_group = -1;
 	state.finished = false;
 	state.group_offset = 0;
+	state.group_row_start = 0;
+	state.group_row_end = NumericLimits<idx_t>::Maximum();
 	state.group_idx_list = std::move(groups_to_read);
 	state.sel.Initialize(STANDARD_VECTOR_SIZE);
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
 
-		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
+		if ((!file_handle->OnDiskFile() || state.prefetch_all_files) && file_handle->CanSeek()) {
 			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			if (!file_handle->OnDiskFile()) {
+				// for files on disk, direct IO would bypass the page cache (and requires aligned reads)
+				flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			}
 		} else {
 			state.prefetch_mode = false;
 		}
 
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
+		// prefetched files are read with concurrent requests by the concurrent reader of the scan
+		state.thrift_file_proto = CreateThriftProtocol(allocator, *state.file_handle, state.prefetch_mode,
+		                                               state.prefetch_mode ? state.concurrent_reader.get() : nullptr);
 	}
-
-	state.thrift_file_proto = CreateThriftProtocol(allocator, *state.file_handle, state.prefetch_mode);
 	state.root_reader = CreateReader();
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -757,7 +983,34 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count);
+
+// Evaluates the filter once for every dictionary entry that is referenced, instead of once for every row
+static void ApplyDictionaryFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	auto &sel = DictionaryVector::SelVector(v);
+	idx_t dictionary_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		dictionary_count = MaxValue<idx_t>(dictionary_count, sel.get_index(i) + 1);
+	}
+	if (dictionary_count > count) {
+		// the rows refer to a large part of the dictionary, evaluating the rows themselves is cheaper
+		v.Flatten(count);
+		ApplyFilter(v, filter, filter_mask, count);
+		return;
+	}
+	parquet_filter_t dictionary_mask;
+	dictionary_mask.set();
+	ApplyFilter(DictionaryVector::Child(v), filter, dictionary_mask, dictionary_count);
+	for (idx_t i = 0; i < count; i++) {
+		filter_mask[i] = filter_mask[i] && dictionary_mask[sel.get_index(i)];
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (v.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		ApplyDictionaryFilter(v, filter, filter_mask, count);
+		return;
+	}
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
@@ -897,10 +1150,35 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				}
 			}
 		}
+		PrepareRowGroupPageSelection(state);
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	idx_t scan_end = GetGroup(state).num_rows;
+	if (!state.selected_ranges.empty()) {
+		auto &ranges = state.selected_ranges;
+		while (state.current_range < ranges.size() && ranges[state.current_range].second <= state.group_offset) {
+			state.current_range++;
+		}
+		if (state.current_range == ranges.size()) {
+			// the page index excluded the remainder of the row group
+			state.group_offset = scan_end;
+			return true;
+		}
+		auto &range = ranges[state.current_range];
+		if (state.group_offset < range.first) {
+			// skip the rows that the page index excluded, this allows the column readers to skip entire pages
+			auto skip_count = range.first - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset = range.first;
+		}
+		scan_end = range.second;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, scan_end - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -924,8 +1202,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
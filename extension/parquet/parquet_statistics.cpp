@@ -225,7 +225,12 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(s_ele, type, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformColumnStatistics(const SchemaElement &s_ele, const LogicalType &type,
+                                                  const duckdb_parquet::format::Statistics &parquet_stats) {
 	duckdb::unique_ptr<BaseStatistics> row_group_stats;
 
 	switch (type.id()) {
@@ -226,8 +226,10 @@ void VerifyUniqueNames(const vector<string> &names) {
 }
 
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalType> types_p, vector<string> names_p,
-                             CompressionCodec::type codec)
-    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec) {
+                             CompressionCodec::type codec, idx_t page_size, bool write_page_index,
+                             const vector<idx_t> &bloom_filter_columns)
+    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
+      page_size(page_size), write_page_index(write_page_index) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -259,6 +261,52 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 		column_writers.push_back(ColumnWriter::CreateWriterRecursive(file_meta_data.schema, *this, sql_types[i],
 		                                                             unique_names[i], schema_path));
 	}
+	for (auto &column_idx : bloom_filter_columns) {
+		D_ASSERT(SupportsBloomFilter(sql_types[column_idx]));
+		bloom_filter_schemas.insert(column_writers[column_idx]->schema_idx);
+	}
+}
+
+bool ParquetWriter::SupportsBloomFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIME_TZ:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return true;
+	case LogicalTypeId::DECIMAL:
+		// decimals that are stored as a fixed length byte array are not supported
+		return type.InternalType() != PhysicalType::INT128;
+	default:
+		return false;
+	}
+}
+
+void ParquetWriter::AddPageIndex(idx_t column_idx, unique_ptr<ParquetPageIndex> page_index) {
+	// this is called while flushing the row group, before it is added to the file meta data
+	page_index->row_group_idx = file_meta_data.row_groups.size();
+	page_index->column_idx = column_idx;
+	page_indexes.push_back(std::move(page_index));
+}
+
+void ParquetWriter::AddBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter) {
+	bloom_filters.push_back(make_pair(column_idx, std::move(bloom_filter)));
 }
 
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
@@ -303,6 +351,15 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 		auto write_state = std::move(states[col_idx]);
 		col_writer->FinalizeWrite(*write_state);
 	}
+	// the Bloom filters are written after the column chunks of the row group
+	for (auto &entry : bloom_filters) {
+		auto &column_chunk = row_group.columns[entry.first];
+		auto bloom_filter_offset = writer->GetTotalWritten();
+		entry.second->Write(*protocol);
+		column_chunk.meta_data.__set_bloom_filter_offset(bloom_filter_offset);
+		column_chunk.meta_data.__set_bloom_filter_length(writer->GetTotalWritten() - bloom_filter_offset);
+	}
+	bloom_filters.clear();
 
 	// append the row group to the file meta data
 	file_meta_data.row_groups.push_back(row_group);
@@ -321,6 +378,26 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 }
 
 void ParquetWriter::Finalize() {
+	// write the page indexes, all column indexes are written first, followed by all offset indexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index->has_column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index->row_group_idx].columns[page_index->column_idx];
+		auto column_index_offset = writer->GetTotalWritten();
+		page_index->column_index.write(protocol.get());
+		column_chunk.__set_column_index_offset(column_index_offset);
+		column_chunk.__set_column_index_length(writer->GetTotalWritten() - column_index_offset);
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index->row_group_idx].columns[page_index->column_idx];
+		auto offset_index_offset = writer->GetTotalWritten();
+		page_index->offset_index.write(protocol.get());
+		column_chunk.__set_offset_index_offset(offset_index_offset);
+		column_chunk.__set_offset_index_length(writer->GetTotalWritten() - offset_index_offset);
+	}
+	page_indexes.clear();
+
 	auto start_offset = writer->GetTotalWritten();
 	file_meta_data.write(protocol.get());
 
@@ -161,8 +161,125 @@ public:
 	}
 
 	ZStdFileSystem zstd_fs;
+	//! For files in the seekable zstd format: the decompressed size of the frame at each offset of the file
+	unordered_map<idx_t, idx_t> seek_table;
 };
 
+static uint32_t LoadLittleEndian32(const_data_ptr_t data) {
+	return uint32_t(data[0]) | uint32_t(data[1]) << 8 | uint32_t(data[2]) << 16 | uint32_t(data[3]) << 24;
+}
+
+// The seekable zstd format stores the sizes of its frames in a skippable frame at the end of the file, which allows
+// us to decompress frames in parallel even if the frames themselves do not store their decompressed size
+static constexpr const uint32_t ZSTD_SEEKABLE_MAGIC_NUMBER = 0x8F92EAB1;
+static constexpr const idx_t ZSTD_SEEKABLE_FOOTER_SIZE = 9;
+static constexpr const idx_t ZSTD_SKIPPABLE_HEADER_SIZE = 8;
+
+static void ReadSeekTable(ZStdFile &file) {
+	auto file_size = idx_t(file.child_handle->GetFileSize());
+	if (file_size < ZSTD_SKIPPABLE_HEADER_SIZE + ZSTD_SEEKABLE_FOOTER_SIZE) {
+		return;
+	}
+	data_t footer[ZSTD_SEEKABLE_FOOTER_SIZE];
+	file.child_handle->Seek(file_size - ZSTD_SEEKABLE_FOOTER_SIZE);
+	if (file.child_handle->Read(footer, ZSTD_SEEKABLE_FOOTER_SIZE) != ZSTD_SEEKABLE_FOOTER_SIZE ||
+	    LoadLittleEndian32(footer + 5) != ZSTD_SEEKABLE_MAGIC_NUMBER) {
+		return;
+	}
+	idx_t frame_count = LoadLittleEndian32(footer);
+	// the descriptor indicates if every entry has a checksum, the other bits are reserved
+	auto descriptor = footer[4];
+	if (descriptor & 0x7F) {
+		return;
+	}
+	idx_t entry_size = descriptor & 0x80 ? 12 : 8;
+	idx_t table_size = ZSTD_SKIPPABLE_HEADER_SIZE + frame_count * entry_size + ZSTD_SEEKABLE_FOOTER_SIZE;
+	if (table_size > file_size) {
+		return;
+	}
+	auto table = make_unsafe_uniq_array<data_t>(frame_count * entry_size);
+	file.child_handle->Seek(file_size - table_size + ZSTD_SKIPPABLE_HEADER_SIZE);
+	if (idx_t(file.child_handle->Read(table.get(), frame_count * entry_size)) != frame_count * entry_size) {
+		return;
+	}
+	idx_t frame_offset = 0;
+	for (idx_t frame_idx = 0; frame_idx < frame_count; frame_idx++) {
+		auto entry = table.get() + frame_idx * entry_size;
+		file.seek_table[frame_offset] = LoadLittleEndian32(entry + 4);
+		frame_offset += LoadLittleEndian32(entry);
+	}
+	if (frame_offset + table_size > file_size) {
+		// the seek table does not describe this file
+		file.seek_table.clear();
+	}
+}
+
+bool ZStdFileSystem::SupportsBlockDecompression(CompressedFile &file) {
+	auto &zstd_file = file.Cast<ZStdFile>();
+	zstd_file.seek_table.clear();
+	data_t magic[4];
+	if (file.child_handle->Read(magic, 4) != 4) {
+		return false;
+	}
+	auto magic_number = LoadLittleEndian32(magic);
+	if (magic_number != ZSTD_MAGICNUMBER &&
+	    (magic_number & ZSTD_MAGIC_SKIPPABLE_MASK) != ZSTD_MAGIC_SKIPPABLE_START) {
+		return false;
+	}
+	ReadSeekTable(zstd_file);
+	return true;
+}
+
+CompressedBlockResult ZStdFileSystem::FindBlock(CompressedFile &file, idx_t file_offset, const_data_ptr_t data,
+                                                idx_t size, CompressedBlock &result) {
+	if (size < ZSTD_SKIPPABLE_HEADER_SIZE) {
+		return CompressedBlockResult::INCOMPLETE;
+	}
+	auto magic_number = LoadLittleEndian32(data);
+	if ((magic_number & ZSTD_MAGIC_SKIPPABLE_MASK) == ZSTD_MAGIC_SKIPPABLE_START) {
+		// skippable frames (such as the seek table) do not contain any data
+		result.compressed_size = ZSTD_SKIPPABLE_HEADER_SIZE + LoadLittleEndian32(data + 4);
+		result.decompressed_size = 0;
+		return size < result.compressed_size ? CompressedBlockResult::INCOMPLETE : CompressedBlockResult::BLOCK;
+	}
+	if (magic_number != ZSTD_MAGICNUMBER) {
+		return CompressedBlockResult::UNSUPPORTED;
+	}
+	auto frame_size = duckdb_zstd::ZSTD_findFrameCompressedSize(data, size);
+	if (duckdb_zstd::ZSTD_isError(frame_size)) {
+		// the frame does not end within the input
+		return CompressedBlockResult::INCOMPLETE;
+	}
+	auto content_size = duckdb_zstd::ZSTD_getFrameContentSize(data, size);
+	if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+		return CompressedBlockResult::UNSUPPORTED;
+	}
+	if (content_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+		auto &zstd_file = file.Cast<ZStdFile>();
+		auto entry = zstd_file.seek_table.find(file_offset);
+		if (entry == zstd_file.seek_table.end()) {
+			return CompressedBlockResult::UNSUPPORTED;
+		}
+		content_size = entry->second;
+	}
+	result.compressed_size = frame_size;
+	result.decompressed_size = content_size;
+	return CompressedBlockResult::BLOCK;
+}
+
+void ZStdFileSystem::DecompressBlock(const_data_ptr_t data, const CompressedBlock &block, data_ptr_t out) {
+	if (block.decompressed_size == 0) {
+		return;
+	}
+	auto res = duckdb_zstd::ZSTD_decompress(out, block.decompressed_size, data, block.compressed_size);
+	if (duckdb_zstd::ZSTD_isError(res)) {
+		throw IOException(duckdb_zstd::ZSTD_getErrorName(res));
+	}
+	if (res != block.decompressed_size) {
+		throw IOException("Decompressed size of zstd frame does not match its content size");
+	}
+}
+
 unique_ptr<FileHandle> ZStdFileSystem::OpenCompressedFile(duckdb::unique_ptr<FileHandle> handle, bool write) {
 	auto path = handle->path;
 	return make_uniq<ZStdFile>(std::move(handle), path, write);
@@ -0,0 +1,105 @@
+#include "duckdb/common/aho_corasick.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+AhoCorasick::AhoCorasick(const vector<string> &patterns)
+    : always_match(false), class_count(1), single_first_byte(true), first_byte(0) {
+	D_ASSERT(!patterns.empty());
+	memset(byte_classes, 0, sizeof(byte_classes));
+	for (auto &pattern : patterns) {
+		if (pattern.empty()) {
+			// the empty string is contained in every string
+			always_match = true;
+			return;
+		}
+		for (auto c : pattern) {
+			auto &byte_class = byte_classes[uint8_t(c)];
+			if (byte_class == 0) {
+				byte_class = class_count++;
+			}
+		}
+		if (pattern[0] != patterns[0][0]) {
+			single_first_byte = false;
+		}
+	}
+	first_byte = patterns[0][0];
+
+	// build the trie of the patterns
+	// the start state is never the target of a transition in the trie, so 0 marks a missing transition
+	vector<uint32_t> trie(class_count, 0);
+	vector<bool> accepting(1, false);
+	for (auto &pattern : patterns) {
+		uint32_t state = 0;
+		for (auto c : pattern) {
+			auto transition_idx = state * class_count + byte_classes[uint8_t(c)];
+			if (trie[transition_idx] == 0) {
+				trie[transition_idx] = accepting.size();
+				accepting.push_back(false);
+				trie.resize(trie.size() + class_count, 0);
+			}
+			state = trie[transition_idx];
+		}
+		accepting[state] = true;
+	}
+
+	// compute the failure links in breadth-first order, and fill in the missing transitions from them
+	auto state_count = accepting.size();
+	vector<uint32_t> fail(state_count, 0);
+	vector<uint32_t> delta(state_count * class_count, 0);
+	vector<uint32_t> queue;
+	queue.reserve(state_count);
+	queue.push_back(0);
+	for (idx_t queue_idx = 0; queue_idx < queue.size(); queue_idx++) {
+		auto state = queue[queue_idx];
+		for (idx_t byte_class = 0; byte_class < class_count; byte_class++) {
+			auto child = trie[state * class_count + byte_class];
+			if (child != 0) {
+				fail[child] = state == 0 ? 0 : delta[fail[state] * class_count + byte_class];
+				// a state that has a pattern as suffix also matches
+				if (accepting[fail[child]]) {
+					accepting[child] = true;
+				}
+				delta[state * class_count + byte_class] = child;
+				queue.push_back(child);
+			} else {
+				auto fail_transition = delta[fail[state] * class_count + byte_class];
+				delta[state * class_count + byte_class] = state == 0 ? 0 : fail_transition;
+			}
+		}
+	}
+
+	// we only need to know whether any pattern matches, so transitions into accepting states are replaced by MATCH
+	transitions.resize(delta.size());
+	for (idx_t i = 0; i < delta.size(); i++) {
+		transitions[i] = accepting[delta[i]] ? MATCH : uint32_t(delta[i] * class_count);
+	}
+}
+
+bool AhoCorasick::ContainsAny(const char *data, idx_t size) const {
+	if (always_match) {
+		return true;
+	}
+	auto table = transitions.data();
+	uint32_t state = 0;
+	idx_t offset = 0;
+	while (offset < size) {
+		if (state == 0 && single_first_byte) {
+			// skip ahead to the next position at which a match can start
+			auto next = memchr(data + offset, first_byte, size - offset);
+			if (!next) {
+				return false;
+			}
+			offset = const_char_ptr_cast(next) - data;
+		}
+		state = table[state + byte_classes[uint8_t(data[offset])]];
+		if (state == MATCH) {
+			return true;
+		}
+		offset++;
+	}
+	return false;
+}
+
+} // namespace duckdb
@@ -1,5 +1,13 @@
 #include "duckdb/common/compressed_file_system.hpp"
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/parallel/task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
+
 namespace duckdb {
 
 StreamWrapper::~StreamWrapper() {
@@ -26,10 +34,219 @@ void CompressedFile::Initialize(bool write) {
 	stream_data.out_buff_start = stream_data.out_buff.get();
 	stream_data.out_buff_end = stream_data.out_buff.get();
 
+	if (!write && child_handle->CanSeek()) {
+		// check if the file consists of independent blocks that we can decompress in parallel
+		// we can always fall back to streaming decompression by seeking to the start of a block
+		decompress_blocks = compressed_fs.SupportsBlockDecompression(*this);
+		child_handle->Seek(0);
+	}
+	if (decompress_blocks) {
+		block_input = make_unsafe_uniq_array<data_t>(INITIAL_BLOCK_INPUT_SIZE);
+		block_input_capacity = INITIAL_BLOCK_INPUT_SIZE;
+		return;
+	}
+	stream_wrapper = compressed_fs.CreateStream();
+	stream_wrapper->Initialize(*this, write);
+}
+
+void CompressedFile::StartStream(idx_t file_offset) {
+	decompress_blocks = false;
+	block_input.reset();
+	block_input_capacity = 0;
+	block_output.reset();
+	block_output_capacity = 0;
+	child_handle->Seek(file_offset);
 	stream_wrapper = compressed_fs.CreateStream();
 	stream_wrapper->Initialize(*this, write);
 }
 
+void CompressedFile::ResizeBlockInput(idx_t new_capacity) {
+	auto new_input = make_unsafe_uniq_array<data_t>(new_capacity);
+	memcpy(new_input.get(), block_input.get() + block_input_position, block_input_size - block_input_position);
+	block_input = std::move(new_input);
+	block_input_capacity = new_capacity;
+	block_input_offset += block_input_position;
+	block_input_size -= block_input_position;
+	block_input_position = 0;
+}
+
+bool CompressedFile::ReadBlocks() {
+	vector<CompressedBlock> blocks;
+	idx_t output_size = 0;
+	auto result = CompressedBlockResult::END;
+	auto output_limit = MinValue<idx_t>(block_input_capacity * 8, MAX_BLOCK_OUTPUT_SIZE);
+	while (true) {
+		// move the input that was not decompressed yet to the front of the buffer, and fill up the remainder
+		auto remaining = block_input_size - block_input_position;
+		memmove(block_input.get(), block_input.get() + block_input_position, remaining);
+		block_input_offset += block_input_position;
+		block_input_size = remaining;
+		block_input_position = 0;
+		while (block_input_size < block_input_capacity) {
+			auto read_count =
+			    child_handle->Read(block_input.get() + block_input_size, block_input_capacity - block_input_size);
+			if (read_count <= 0) {
+				break;
+			}
+			block_input_size += read_count;
+		}
+
+		// locate the complete blocks in the input
+		while (block_input_position < block_input_size) {
+			CompressedBlock block;
+			result = compressed_fs.FindBlock(*this, block_input_offset + block_input_position,
+			                                 block_input.get() + block_input_position,
+			                                 block_input_size - block_input_position, block);
+			if (result != CompressedBlockResult::BLOCK || block.decompressed_size > MAX_BLOCK_SIZE ||
+			    (!blocks.empty() && output_size + block.decompressed_size > output_limit)) {
+				break;
+			}
+			D_ASSERT(block.compressed_size > 0);
+			block.offset = block_input_position;
+			block.output_offset = output_size;
+			blocks.push_back(block);
+			block_input_position += block.compressed_size;
+			output_size += block.decompressed_size;
+		}
+		if (!blocks.empty() || result != CompressedBlockResult::INCOMPLETE ||
+		    block_input_size < block_input_capacity || block_input_capacity >= BLOCK_INPUT_SIZE) {
+			break;
+		}
+		// the first block does not fit in the input buffer: grow the buffer and try again
+		ResizeBlockInput(MinValue<idx_t>(block_input_capacity * 2, BLOCK_INPUT_SIZE));
+	}
+	if (blocks.empty() && result == CompressedBlockResult::END) {
+		// finished reading the file, or the remainder of the file is not part of the compressed data
+		decompress_blocks = false;
+		block_input.reset();
+		block_input_capacity = 0;
+		block_output.reset();
+		block_output_capacity = 0;
+		return false;
+	}
+	if (blocks.empty()) {
+		// the input does not start with a block we can decompress independently, or the block is too large:
+		// decompress the rest of the file as a stream (which also reports truncated or corrupt input)
+		StartStream(block_input_offset);
+		return true;
+	}
+
+	if (output_size > block_output_capacity) {
+		block_output = make_unsafe_uniq_array<data_t>(output_size);
+		block_output_capacity = output_size;
+	}
+	DecompressBlocks(blocks);
+	stream_data.out_buff_start = block_output.get();
+	stream_data.out_buff_end = block_output.get() + output_size;
+	if (block_input_capacity < BLOCK_INPUT_SIZE) {
+		// we start with small batches, as only the start of the file is read when e.g. sniffing a CSV file
+		ResizeBlockInput(MinValue<idx_t>(block_input_capacity * 2, BLOCK_INPUT_SIZE));
+	}
+	return true;
+}
+
+//! The state of a batch of blocks that is decompressed in parallel. Tasks of the batch can still be executed after the
+//! batch is decompressed, so they only access the buffers of the file after claiming a block.
+struct BlockDecompressState {
+	BlockDecompressState(CompressedFileSystem &fs, const_data_ptr_t input, data_ptr_t output,
+	                     const vector<CompressedBlock> &blocks)
+	    : fs(fs), input(input), output(output), blocks(blocks), block_count(blocks.size()), next_block(0) {
+	}
+
+	CompressedFileSystem &fs;
+	const_data_ptr_t input;
+	data_ptr_t output;
+	const vector<CompressedBlock> &blocks;
+	idx_t block_count;
+	//! The next block that no thread is decompressing yet
+	atomic<idx_t> next_block;
+
+	mutex lock;
+	//! Signalled when a task stops decompressing blocks
+	std::condition_variable task_done;
+	//! The number of tasks that are decompressing blocks
+	idx_t active_tasks = 0;
+	//! The first error a task ran into
+	std::exception_ptr error;
+
+	//! Decompresses blocks until none are left
+	void DecompressBlocks() {
+		for (idx_t block_idx = next_block++; block_idx < block_count; block_idx = next_block++) {
+			auto &block = blocks[block_idx];
+			fs.DecompressBlock(input + block.offset, block, output + block.output_offset);
+		}
+	}
+};
+
+class BlockDecompressTask : public Task {
+public:
+	explicit BlockDecompressTask(shared_ptr<BlockDecompressState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		{
+			lock_guard<mutex> guard(state->lock);
+			state->active_tasks++;
+		}
+		std::exception_ptr error;
+		try {
+			state->DecompressBlocks();
+		} catch (...) {
+			error = std::current_exception();
+			// stop the other threads from starting on the remaining blocks
+			state->next_block = state->block_count;
+		}
+		lock_guard<mutex> guard(state->lock);
+		if (error && !state->error) {
+			state->error = error;
+		}
+		state->active_tasks--;
+		state->task_done.notify_all();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<BlockDecompressState> state;
+};
+
+void CompressedFile::DecompressBlocks(const vector<CompressedBlock> &blocks) {
+	auto state = make_shared<BlockDecompressState>(compressed_fs, block_input.get(), block_output.get(), blocks);
+	idx_t thread_count = scheduler ? MinValue<idx_t>(scheduler->NumberOfThreads(), blocks.size()) : 1;
+	if (thread_count <= 1) {
+		state->DecompressBlocks();
+		return;
+	}
+	// schedule a task for every other thread: the threads of the scheduler that are idle help to decompress the
+	// blocks, while this thread decompresses blocks as well
+	if (!producer) {
+		producer = scheduler->CreateProducer();
+	}
+	for (idx_t task_idx = 1; task_idx < thread_count; task_idx++) {
+		scheduler->ScheduleTask(*producer, make_shared<BlockDecompressTask>(state));
+	}
+	std::exception_ptr error;
+	try {
+		state->DecompressBlocks();
+	} catch (...) {
+		error = std::current_exception();
+		state->next_block = state->block_count;
+	}
+	// take back the tasks that no thread has started, and wait for the tasks that are decompressing blocks
+	shared_ptr<Task> task;
+	while (scheduler->GetTaskFromProducer(*producer, task)) {
+		task.reset();
+	}
+	unique_lock<mutex> guard(state->lock);
+	state->task_done.wait(guard, [&]() { return state->active_tasks == 0; });
+	if (!error) {
+		error = state->error;
+	}
+	guard.unlock();
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
 int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 	idx_t total_read = 0;
 	while (true) {
@@ -48,6 +265,12 @@ int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 				return total_read;
 			}
 		}
+		if (decompress_blocks) {
+			if (!ReadBlocks()) {
+				return total_read;
+			}
+			continue;
+		}
 		if (!stream_wrapper) {
 			return total_read;
 		}
@@ -104,6 +327,14 @@ void CompressedFile::Close() {
 		stream_wrapper->Close();
 		stream_wrapper.reset();
 	}
+	decompress_blocks = false;
+	block_input.reset();
+	block_input_capacity = 0;
+	block_input_offset = 0;
+	block_input_size = 0;
+	block_input_position = 0;
+	block_output.reset();
+	block_output_capacity = 0;
 	stream_data.in_buff.reset();
 	stream_data.out_buff.reset();
 	stream_data.out_buff_start = nullptr;
@@ -144,4 +375,17 @@ bool CompressedFileSystem::CanSeek() {
 	return false;
 }
 
+bool CompressedFileSystem::SupportsBlockDecompression(CompressedFile &file) {
+	return false;
+}
+
+CompressedBlockResult CompressedFileSystem::FindBlock(CompressedFile &file, idx_t file_offset, const_data_ptr_t data,
+                                                      idx_t size, CompressedBlock &result) {
+	return CompressedBlockResult::UNSUPPORTED;
+}
+
+void CompressedFileSystem::DecompressBlock(const_data_ptr_t data, const CompressedBlock &block, data_ptr_t out) {
+	throw InternalException("CompressedFileSystem::DecompressBlock not implemented for %s", GetName());
+}
+
 } // namespace duckdb
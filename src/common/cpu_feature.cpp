@@ -0,0 +1,28 @@
+#include "duckdb/common/cpu_feature.hpp"
+
+namespace duckdb {
+
+CPUFeature CPUFeatures::DetectBestFeature() {
+#ifdef DUCKDB_SIMD_DISPATCH
+	// __builtin_cpu_supports also checks whether the OS saves the (wider) registers on a context switch
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+	    __builtin_cpu_supports("avx512vl")) {
+		return CPUFeature::AVX512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return CPUFeature::AVX2;
+	}
+	if (__builtin_cpu_supports("sse4.2")) {
+		return CPUFeature::SSE42;
+	}
+#endif
+	return CPUFeature::DEFAULT;
+}
+
+CPUFeature CPUFeatures::GetBestFeature() {
+	static const CPUFeature BEST_FEATURE = DetectBestFeature();
+	return BEST_FEATURE;
+}
+
+} // namespace duckdb
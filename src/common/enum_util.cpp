@@ -93,6 +93,7 @@
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 #include "duckdb/common/enums/index_type.hpp"
 #include "duckdb/common/enums/output_type.hpp"
+#include "duckdb/common/enums/cte_materialize.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/operator/persistent/base_csv_reader.hpp"
@@ -879,6 +880,8 @@ const char *EnumUtil::ToChars<QueryNodeType>(QueryNodeType value) {
 		return "BOUND_SUBQUERY_NODE";
 	case QueryNodeType::RECURSIVE_CTE_NODE:
 		return "RECURSIVE_CTE_NODE";
+	case QueryNodeType::CTE_NODE:
+		return "CTE_NODE";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -898,6 +901,9 @@ QueryNodeType EnumUtil::FromString<QueryNodeType>(const char *value) {
 	if (StringUtil::Equals(value, "RECURSIVE_CTE_NODE")) {
 		return QueryNodeType::RECURSIVE_CTE_NODE;
 	}
+	if (StringUtil::Equals(value, "CTE_NODE")) {
+		return QueryNodeType::CTE_NODE;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -2554,6 +2560,8 @@ const char *EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -2578,6 +2586,8 @@ const char *EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "CHUNK_SCAN";
 	case PhysicalOperatorType::RECURSIVE_CTE_SCAN:
 		return "RECURSIVE_CTE_SCAN";
+	case PhysicalOperatorType::CTE_SCAN:
+		return "CTE_SCAN";
 	case PhysicalOperatorType::DELIM_SCAN:
 		return "DELIM_SCAN";
 	case PhysicalOperatorType::EXPRESSION_SCAN:
@@ -2608,6 +2618,8 @@ const char *EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
 		return "RECURSIVE_CTE";
+	case PhysicalOperatorType::CTE:
+		return "CTE";
 	case PhysicalOperatorType::INSERT:
 		return "INSERT";
 	case PhysicalOperatorType::BATCH_INSERT:
@@ -2712,6 +2724,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -2748,6 +2763,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "RECURSIVE_CTE_SCAN")) {
 		return PhysicalOperatorType::RECURSIVE_CTE_SCAN;
 	}
+	if (StringUtil::Equals(value, "CTE_SCAN")) {
+		return PhysicalOperatorType::CTE_SCAN;
+	}
 	if (StringUtil::Equals(value, "DELIM_SCAN")) {
 		return PhysicalOperatorType::DELIM_SCAN;
 	}
@@ -2793,6 +2811,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "RECURSIVE_CTE")) {
 		return PhysicalOperatorType::RECURSIVE_CTE;
 	}
+	if (StringUtil::Equals(value, "CTE")) {
+		return PhysicalOperatorType::CTE;
+	}
 	if (StringUtil::Equals(value, "INSERT")) {
 		return PhysicalOperatorType::INSERT;
 	}
@@ -4649,6 +4670,8 @@ const char *EnumUtil::ToChars<LogicalOperatorType>(LogicalOperatorType value) {
 		return "LOGICAL_INTERSECT";
 	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE:
 		return "LOGICAL_RECURSIVE_CTE";
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE:
+		return "LOGICAL_MATERIALIZED_CTE";
 	case LogicalOperatorType::LOGICAL_INSERT:
 		return "LOGICAL_INSERT";
 	case LogicalOperatorType::LOGICAL_DELETE:
@@ -4804,6 +4827,9 @@ LogicalOperatorType EnumUtil::FromString<LogicalOperatorType>(const char *value)
 	if (StringUtil::Equals(value, "LOGICAL_RECURSIVE_CTE")) {
 		return LogicalOperatorType::LOGICAL_RECURSIVE_CTE;
 	}
+	if (StringUtil::Equals(value, "LOGICAL_MATERIALIZED_CTE")) {
+		return LogicalOperatorType::LOGICAL_MATERIALIZED_CTE;
+	}
 	if (StringUtil::Equals(value, "LOGICAL_INSERT")) {
 		return LogicalOperatorType::LOGICAL_INSERT;
 	}
@@ -5134,6 +5160,34 @@ SetOperationType EnumUtil::FromString<SetOperationType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template <>
+const char *EnumUtil::ToChars<CTEMaterialize>(CTEMaterialize value) {
+	switch (value) {
+	case CTEMaterialize::CTE_MATERIALIZE_DEFAULT:
+		return "CTE_MATERIALIZE_DEFAULT";
+	case CTEMaterialize::CTE_MATERIALIZE_ALWAYS:
+		return "CTE_MATERIALIZE_ALWAYS";
+	case CTEMaterialize::CTE_MATERIALIZE_NEVER:
+		return "CTE_MATERIALIZE_NEVER";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template <>
+CTEMaterialize EnumUtil::FromString<CTEMaterialize>(const char *value) {
+	if (StringUtil::Equals(value, "CTE_MATERIALIZE_DEFAULT")) {
+		return CTEMaterialize::CTE_MATERIALIZE_DEFAULT;
+	}
+	if (StringUtil::Equals(value, "CTE_MATERIALIZE_ALWAYS")) {
+		return CTEMaterialize::CTE_MATERIALIZE_ALWAYS;
+	}
+	if (StringUtil::Equals(value, "CTE_MATERIALIZE_NEVER")) {
+		return CTEMaterialize::CTE_MATERIALIZE_NEVER;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template <>
 const char *EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 	switch (value) {
@@ -5167,6 +5221,8 @@ const char *EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "COLUMN_LIFETIME";
 	case OptimizerType::TOP_N:
 		return "TOP_N";
+	case OptimizerType::SORT_ELIMINATION:
+		return "SORT_ELIMINATION";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
 	case OptimizerType::EXTENSION:
@@ -5223,6 +5279,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "TOP_N")) {
 		return OptimizerType::TOP_N;
 	}
+	if (StringUtil::Equals(value, "SORT_ELIMINATION")) {
+		return OptimizerType::SORT_ELIMINATION;
+	}
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
@@ -117,7 +117,9 @@ void MiniZStreamWrapper::Initialize(CompressedFile &file, bool write) {
 			throw InternalException("Failed to initialize miniz");
 		}
 	} else {
-		idx_t data_start = GZIP_HEADER_MINSIZE;
+		// the header is not at the start of the file if we switched from decompressing blocks to a stream halfway
+		idx_t header_start = file.child_handle->CanSeek() ? file.child_handle->SeekPosition() : 0;
+		idx_t data_start = header_start + GZIP_HEADER_MINSIZE;
 		auto read_count = file.child_handle->Read(gzip_hdr, GZIP_HEADER_MINSIZE);
 		GZipFileSystem::VerifyGZIPHeader(gzip_hdr, read_count);
 		// Skip over the extra field if necessary
@@ -382,6 +384,96 @@ string GZipFileSystem::UncompressGZIPString(const string &in) {
 	return decompressed;
 }
 
+//! BGZF files (as written by e.g. bgzip) consist of gzip members of at most 64KB, which store their total size in
+//! the "BC" subfield of the extra field. This allows us to find and decompress the members in parallel.
+//! Regular gzip files (a single deflate stream) are always decompressed sequentially: a deflate stream can only be
+//! split by speculatively decoding from guessed block boundaries, which we do not do.
+static CompressedBlockResult GetBGZFBlockSize(const_data_ptr_t data, idx_t size, idx_t &header_size,
+                                              idx_t &block_size) {
+	if (size < GZIP_HEADER_MINSIZE + 2) {
+		return data[0] == 0x1F ? CompressedBlockResult::INCOMPLETE : CompressedBlockResult::END;
+	}
+	if (data[0] != 0x1F) {
+		// not a concatenated gzip member: the stream decompressor ignores the trailing data as well
+		return CompressedBlockResult::END;
+	}
+	if (data[1] != 0x8B || data[2] != GZIP_COMPRESSION_DEFLATE || data[3] != GZIP_FLAG_EXTRA) {
+		return CompressedBlockResult::UNSUPPORTED;
+	}
+	idx_t xlen = data[GZIP_HEADER_MINSIZE] | data[GZIP_HEADER_MINSIZE + 1] << 8;
+	header_size = GZIP_HEADER_MINSIZE + 2 + xlen;
+	if (size < header_size) {
+		return CompressedBlockResult::INCOMPLETE;
+	}
+	// look for the "BC" subfield in the extra field
+	idx_t position = GZIP_HEADER_MINSIZE + 2;
+	while (position + 4 <= header_size) {
+		idx_t subfield_size = data[position + 2] | data[position + 3] << 8;
+		if (data[position] == 'B' && data[position + 1] == 'C' && subfield_size == 2 &&
+		    position + 6 <= header_size) {
+			block_size = (data[position + 4] | data[position + 5] << 8) + 1;
+			if (block_size < header_size + GZIP_FOOTER_SIZE) {
+				return CompressedBlockResult::UNSUPPORTED;
+			}
+			return CompressedBlockResult::BLOCK;
+		}
+		position += 4 + subfield_size;
+	}
+	return CompressedBlockResult::UNSUPPORTED;
+}
+
+bool GZipFileSystem::SupportsBlockDecompression(CompressedFile &file) {
+	data_t header[GZIP_HEADER_MINSIZE + 64];
+	auto read_count = file.child_handle->Read(header, sizeof(header));
+	if (read_count <= 0) {
+		return false;
+	}
+	idx_t header_size, block_size;
+	return GetBGZFBlockSize(header, read_count, header_size, block_size) == CompressedBlockResult::BLOCK;
+}
+
+CompressedBlockResult GZipFileSystem::FindBlock(CompressedFile &file, idx_t file_offset, const_data_ptr_t data,
+                                                idx_t size, CompressedBlock &result) {
+	idx_t header_size, block_size;
+	auto block_result = GetBGZFBlockSize(data, size, header_size, block_size);
+	if (block_result != CompressedBlockResult::BLOCK) {
+		return block_result;
+	}
+	if (size < block_size) {
+		return CompressedBlockResult::INCOMPLETE;
+	}
+	// the footer contains the decompressed size of the member
+	auto footer = data + block_size - GZIP_FOOTER_SIZE;
+	result.compressed_size = block_size;
+	result.decompressed_size =
+	    idx_t(footer[4]) | idx_t(footer[5]) << 8 | idx_t(footer[6]) << 16 | idx_t(footer[7]) << 24;
+	return CompressedBlockResult::BLOCK;
+}
+
+void GZipFileSystem::DecompressBlock(const_data_ptr_t data, const CompressedBlock &block, data_ptr_t out) {
+	if (block.decompressed_size == 0) {
+		// e.g. the empty block that marks the end of a BGZF file
+		return;
+	}
+	idx_t header_size = GZIP_HEADER_MINSIZE + 2 + (data[GZIP_HEADER_MINSIZE] | data[GZIP_HEADER_MINSIZE + 1] << 8);
+	duckdb_miniz::mz_stream stream;
+	memset(&stream, 0, sizeof(duckdb_miniz::mz_stream));
+	auto ret = duckdb_miniz::mz_inflateInit2(&stream, -MZ_DEFAULT_WINDOW_BITS);
+	if (ret != duckdb_miniz::MZ_OK) {
+		throw InternalException("Failed to initialize miniz");
+	}
+	stream.next_in = data + header_size;
+	stream.avail_in = (uint32_t)(block.compressed_size - header_size - GZIP_FOOTER_SIZE);
+	stream.next_out = out;
+	stream.avail_out = (uint32_t)block.decompressed_size;
+	ret = duckdb_miniz::mz_inflate(&stream, duckdb_miniz::MZ_FINISH);
+	auto total_out = stream.total_out;
+	duckdb_miniz::mz_inflateEnd(&stream);
+	if (ret != duckdb_miniz::MZ_STREAM_END || total_out != block.decompressed_size) {
+		throw IOException("Failed to decode gzip block: %s", duckdb_miniz::mz_error(ret));
+	}
+}
+
 unique_ptr<FileHandle> GZipFileSystem::OpenCompressedFile(unique_ptr<FileHandle> handle, bool write) {
 	auto path = handle->path;
 	return make_uniq<GZipFile>(std::move(handle), path, write);
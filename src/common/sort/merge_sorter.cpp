@@ -11,8 +11,8 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 void MergeSorter::PerformInMergeRound() {
 	while (true) {
 		{
-			lock_guard<mutex> pair_guard(state.lock);
-			if (state.pair_idx == state.num_pairs) {
+			lock_guard<mutex> group_guard(state.lock);
+			if (state.group_idx == state.num_groups) {
 				break;
 			}
 			GetNextPartition();
@@ -22,23 +22,79 @@ void MergeSorter::PerformInMergeRound() {
 }
 
 void MergeSorter::MergePartition() {
-	auto &left_block = *left->sb;
-	auto &right_block = *right->sb;
-#ifdef DEBUG
-	D_ASSERT(left_block.radix_sorting_data.size() == left_block.payload_data->data_blocks.size());
-	D_ASSERT(right_block.radix_sorting_data.size() == right_block.payload_data->data_blocks.size());
-	if (!state.payload_layout.AllConstant() && state.external) {
-		D_ASSERT(left_block.payload_data->data_blocks.size() == left_block.payload_data->heap_blocks.size());
-		D_ASSERT(right_block.payload_data->data_blocks.size() == right_block.payload_data->heap_blocks.size());
+	auto &partition_result = *result;
+	idx_t fan_in = inputs.size();
+	while (true) {
+		try {
+			MergePartition(fan_in);
+			break;
+		} catch (OutOfMemoryException &) {
+			if (fan_in <= 2) {
+				throw;
+			}
+		}
+		// Keeping a block of each of the runs pinned does not fit in memory (e.g., because other threads or operators
+		// use more memory than anticipated): start over, and merge fewer runs at once
+		runs.clear();
+		result = &partition_result;
+		result->radix_sorting_data.clear();
+		result->blob_sorting_data->data_blocks.clear();
+		result->blob_sorting_data->heap_blocks.clear();
+		result->payload_data->data_blocks.clear();
+		result->payload_data->heap_blocks.clear();
+		fan_in = MaxValue<idx_t>(fan_in / 2, 2);
 	}
-	if (!sort_layout.all_constant) {
-		D_ASSERT(left_block.radix_sorting_data.size() == left_block.blob_sorting_data->data_blocks.size());
-		D_ASSERT(right_block.radix_sorting_data.size() == right_block.blob_sorting_data->data_blocks.size());
-		if (state.external) {
-			D_ASSERT(left_block.blob_sorting_data->data_blocks.size() ==
-			         left_block.blob_sorting_data->heap_blocks.size());
-			D_ASSERT(right_block.blob_sorting_data->data_blocks.size() ==
-			         right_block.blob_sorting_data->heap_blocks.size());
+	inputs.clear();
+}
+
+void MergeSorter::MergePartition(const idx_t fan_in) {
+	// Merge the slices of this partition, the slices themselves are kept so we can start over if this fails
+	vector<unique_ptr<SortedBlock>> stage_inputs;
+	vector<idx_t> stage_entry_indices(inputs.size());
+	for (idx_t run_idx = 0; run_idx < inputs.size(); run_idx++) {
+		auto &input = *inputs[run_idx];
+		stage_inputs.push_back(input.CreateSlice(input_entry_indices[run_idx], input.Count(),
+		                                         stage_entry_indices[run_idx]));
+	}
+	// If we cannot merge all of them at once, first merge groups of 'fan_in' runs into intermediate blocks
+	// All of these hold at most block_capacity rows, as that is the size of the partition
+	auto &partition_result = *result;
+	while (stage_inputs.size() > fan_in) {
+		vector<unique_ptr<SortedBlock>> merged_inputs;
+		for (idx_t start = 0; start < stage_inputs.size(); start += fan_in) {
+			const idx_t end = MinValue(start + fan_in, stage_inputs.size());
+			merged_inputs.push_back(make_uniq<SortedBlock>(buffer_manager, state));
+			result = merged_inputs.back().get();
+			MergeRuns(stage_inputs, stage_entry_indices, start, end);
+		}
+		stage_inputs = std::move(merged_inputs);
+		stage_entry_indices.assign(stage_inputs.size(), 0);
+	}
+	result = &partition_result;
+	MergeRuns(stage_inputs, stage_entry_indices, 0, stage_inputs.size());
+}
+
+void MergeSorter::MergeRuns(vector<unique_ptr<SortedBlock>> &run_blocks, const vector<idx_t> &entry_indices,
+                            const idx_t start, const idx_t end) {
+	// Initialize a reader for each of the runs
+	runs.clear();
+	for (idx_t run_idx = start; run_idx < end; run_idx++) {
+		runs.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		runs.back()->sb = run_blocks[run_idx].get();
+		runs.back()->SetIndices(0, entry_indices[run_idx]);
+	}
+#ifdef DEBUG
+	for (auto &run : runs) {
+		auto &block = *run->sb;
+		D_ASSERT(block.radix_sorting_data.size() == block.payload_data->data_blocks.size());
+		if (!state.payload_layout.AllConstant() && state.external) {
+			D_ASSERT(block.payload_data->data_blocks.size() == block.payload_data->heap_blocks.size());
+		}
+		if (!sort_layout.all_constant) {
+			D_ASSERT(block.radix_sorting_data.size() == block.blob_sorting_data->data_blocks.size());
+			if (state.external) {
+				D_ASSERT(block.blob_sorting_data->data_blocks.size() == block.blob_sorting_data->heap_blocks.size());
+			}
 		}
 	}
 #endif
@@ -46,87 +102,84 @@ void MergeSorter::MergePartition() {
 	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
 	result->InitializeWrite();
 	// Initialize arrays to store merge data
-	bool left_smaller[STANDARD_VECTOR_SIZE];
-	idx_t next_entry_sizes[STANDARD_VECTOR_SIZE];
-	// Merge loop
+	idx_t run_indices[STANDARD_VECTOR_SIZE];
+	idx_t remaining = 0;
+	for (auto &run : runs) {
+		remaining += run->Remaining();
+	}
 #ifdef DEBUG
-	auto l_count = left->Remaining();
-	auto r_count = right->Remaining();
+	const auto total_count = remaining;
 #endif
-	while (true) {
-		auto l_remaining = left->Remaining();
-		auto r_remaining = right->Remaining();
-		if (l_remaining + r_remaining == 0) {
-			// Done
-			break;
-		}
-		const idx_t next = MinValue(l_remaining + r_remaining, (idx_t)STANDARD_VECTOR_SIZE);
-		if (l_remaining != 0 && r_remaining != 0) {
-			// Compute the merge (not needed if one side is exhausted)
-			ComputeMerge(next, left_smaller);
-		}
+	// Merge loop
+	while (remaining > 0) {
+		const idx_t next = MinValue(remaining, (idx_t)STANDARD_VECTOR_SIZE);
+		ComputeMerge(next, run_indices);
 		// Actually merge the data (radix, blob, and payload)
-		MergeRadix(next, left_smaller);
+		MergeRadix(next, run_indices);
 		if (!sort_layout.all_constant) {
-			MergeData(*result->blob_sorting_data, *left_block.blob_sorting_data, *right_block.blob_sorting_data, next,
-			          left_smaller, next_entry_sizes, true);
+			MergeData(*result->blob_sorting_data, SortedDataType::BLOB, next, run_indices, true);
 			D_ASSERT(result->radix_sorting_data.size() == result->blob_sorting_data->data_blocks.size());
 		}
-		MergeData(*result->payload_data, *left_block.payload_data, *right_block.payload_data, next, left_smaller,
-		          next_entry_sizes, false);
+		MergeData(*result->payload_data, SortedDataType::PAYLOAD, next, run_indices, false);
 		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
+		remaining -= next;
 	}
 #ifdef DEBUG
-	D_ASSERT(result->Count() == l_count + r_count);
+	D_ASSERT(result->Count() == total_count);
 #endif
+	// Unpin the blocks of the runs
+	runs.clear();
 }
 
 void MergeSorter::GetNextPartition() {
 	// Create result block
-	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
-	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	state.sorted_blocks_temp[state.group_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.group_idx].back().get();
 	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
-	const idx_t l_count = left_block.Count();
-	const idx_t r_count = right_block.Count();
-	// Initialize left and right reader
-	left = make_uniq<SBScanState>(buffer_manager, state);
-	right = make_uniq<SBScanState>(buffer_manager, state);
+	const idx_t group_start = state.group_idx * state.merge_fan_in;
+	const idx_t group_size = MinValue(state.merge_fan_in, state.sorted_blocks.size() - group_start);
+	// Initialize a reader for each of the blocks
+	runs.clear();
+	inputs.clear();
+	vector<idx_t> counts;
+	idx_t start = 0;
+	idx_t total_count = 0;
+	for (idx_t run_idx = 0; run_idx < group_size; run_idx++) {
+		runs.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		runs.back()->sb = state.sorted_blocks[group_start + run_idx].get();
+		counts.push_back(runs.back()->sb->Count());
+		start += state.run_starts[run_idx];
+		total_count += counts.back();
+	}
 	// Compute the work that this thread must do using Merge Path
-	idx_t l_end;
-	idx_t r_end;
-	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
-		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
-		GetIntersection(intersection, l_end, r_end);
-		D_ASSERT(l_end <= l_count);
-		D_ASSERT(r_end <= r_count);
-		D_ASSERT(intersection == l_end + r_end);
+	vector<idx_t> ends;
+	if (start + state.block_capacity < total_count) {
+		GetIntersection(start + state.block_capacity, counts, ends);
 	} else {
-		l_end = l_count;
-		r_end = r_count;
+		ends = counts;
 	}
+	// The readers were only needed to compute the partition, release the blocks they pinned
+	runs.clear();
 	// Create slices of the data that this thread must merge
-	left->SetIndices(0, 0);
-	right->SetIndices(0, 0);
-	left_input = left_block.CreateSlice(state.l_start, l_end, left->entry_idx);
-	right_input = right_block.CreateSlice(state.r_start, r_end, right->entry_idx);
-	left->sb = left_input.get();
-	right->sb = right_input.get();
-	state.l_start = l_end;
-	state.r_start = r_end;
-	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity || (l_end == l_count && r_end == r_count));
+	bool done = true;
+	input_entry_indices.resize(group_size);
+	for (idx_t run_idx = 0; run_idx < group_size; run_idx++) {
+		auto &sorted_block = *state.sorted_blocks[group_start + run_idx];
+		D_ASSERT(ends[run_idx] <= counts[run_idx]);
+		inputs.push_back(
+		    sorted_block.CreateSlice(state.run_starts[run_idx], ends[run_idx], input_entry_indices[run_idx]));
+		state.run_starts[run_idx] = ends[run_idx];
+		done = done && ends[run_idx] == counts[run_idx];
+	}
 	// Update global state
-	if (state.l_start == l_count && state.r_start == r_count) {
-		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
-		// Advance pair
-		state.pair_idx++;
-		state.l_start = 0;
-		state.r_start = 0;
+	if (done) {
+		// Delete references to previous group
+		for (idx_t run_idx = 0; run_idx < group_size; run_idx++) {
+			state.sorted_blocks[group_start + run_idx] = nullptr;
+		}
+		// Advance group
+		state.group_idx++;
+		std::fill(state.run_starts.begin(), state.run_starts.end(), 0);
 	}
 }
 
@@ -134,14 +187,6 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	D_ASSERT(l_idx < l.sb->Count());
 	D_ASSERT(r_idx < r.sb->Count());
 
-	// Easy comparison using the previous result (intersections must increase monotonically)
-	if (l_idx < state.l_start) {
-		return -1;
-	}
-	if (r_idx < state.r_start) {
-		return 1;
-	}
-
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
 
@@ -161,184 +206,196 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	return comp_res;
 }
 
-void MergeSorter::GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx) {
-	const idx_t l_count = left->sb->Count();
-	const idx_t r_count = right->sb->Count();
-	// Cover some edge cases
-	// Code coverage off because these edge cases cannot happen unless other code changes
-	// Edge cases have been tested extensively while developing Merge Path in a script
-	// LCOV_EXCL_START
-	if (diagonal >= l_count + r_count) {
-		l_idx = l_count;
-		r_idx = r_count;
-		return;
-	} else if (diagonal == 0) {
-		l_idx = 0;
-		r_idx = 0;
-		return;
-	} else if (l_count == 0) {
-		l_idx = 0;
-		r_idx = diagonal;
-		return;
-	} else if (r_count == 0) {
-		r_idx = 0;
-		l_idx = diagonal;
-		return;
-	}
-	// LCOV_EXCL_STOP
-	// Determine offsets for the binary search
-	const idx_t l_offset = MinValue(l_count, diagonal);
-	const idx_t r_offset = diagonal > l_count ? diagonal - l_count : 0;
-	D_ASSERT(l_offset + r_offset == diagonal);
-	const idx_t search_space = diagonal > MaxValue(l_count, r_count) ? l_count + r_count - diagonal
-	                                                                 : MinValue(diagonal, MinValue(l_count, r_count));
-	// Double binary search
-	idx_t li = 0;
-	idx_t ri = search_space - 1;
-	idx_t middle;
-	int comp_res;
-	while (li <= ri) {
-		middle = (li + ri) / 2;
-		l_idx = l_offset - middle;
-		r_idx = r_offset + middle;
-		if (l_idx == l_count || r_idx == 0) {
-			comp_res = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-			if (comp_res > 0) {
-				l_idx--;
-				r_idx++;
-			} else {
-				return;
-			}
-			if (l_idx == 0 || r_idx == r_count) {
-				// This case is incredibly difficult to cover as it is dependent on parallelism randomness
-				// But it has been tested extensively during development in a script
-				// LCOV_EXCL_START
-				return;
-				// LCOV_EXCL_STOP
-			} else {
-				break;
-			}
-		}
-		comp_res = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx);
-		if (comp_res > 0) {
+idx_t MergeSorter::CountBefore(const idx_t run, const idx_t begin, const idx_t end, const idx_t pivot_run,
+                               const idx_t pivot_idx) {
+	// Rows that are equal to the pivot come before it if they are in a run with a lower index
+	const int max_comp_res = run < pivot_run ? 0 : -1;
+	idx_t li = begin;
+	idx_t ri = end;
+	while (li < ri) {
+		const idx_t middle = li + (ri - li) / 2;
+		if (CompareUsingGlobalIndex(*runs[run], *runs[pivot_run], middle, pivot_idx) <= max_comp_res) {
 			li = middle + 1;
 		} else {
-			ri = middle - 1;
+			ri = middle;
 		}
 	}
-	int l_r_min1 = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx - 1);
-	int l_min1_r = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-	if (l_r_min1 > 0 && l_min1_r < 0) {
-		return;
-	} else if (l_r_min1 > 0) {
-		l_idx--;
-		r_idx++;
-	} else if (l_min1_r < 0) {
-		l_idx++;
-		r_idx--;
-	}
+	return li;
 }
 
-void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
-	auto &l = *left;
-	auto &r = *right;
-	auto &l_sorted_block = *l.sb;
-	auto &r_sorted_block = *r.sb;
-	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-	// Data pointers for both sides
-	data_ptr_t l_radix_ptr;
-	data_ptr_t r_radix_ptr;
-	// Compute the merge of the next 'count' tuples
-	idx_t compared = 0;
-	while (compared < count) {
-		// Move to the next block (if needed)
-		if (l.block_idx < l_sorted_block.radix_sorting_data.size() &&
-		    l.entry_idx == l_sorted_block.radix_sorting_data[l.block_idx]->count) {
-			l.block_idx++;
-			l.entry_idx = 0;
-		}
-		if (r.block_idx < r_sorted_block.radix_sorting_data.size() &&
-		    r.entry_idx == r_sorted_block.radix_sorting_data[r.block_idx]->count) {
-			r.block_idx++;
-			r.entry_idx = 0;
+void MergeSorter::GetIntersection(const idx_t rank, const vector<idx_t> &counts, vector<idx_t> &ends) {
+	// Multi-sequence selection: we search for the number of rows of each run that are among the first 'rank' rows
+	// The search space of each run is narrowed down by comparing against pivot rows until it is empty
+	const idx_t run_count = runs.size();
+	idx_t start = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		start += state.run_starts[run_idx];
+	}
+	D_ASSERT(rank > start);
+	vector<idx_t> lower(state.run_starts.begin(), state.run_starts.begin() + run_count);
+	vector<idx_t> upper(run_count);
+	vector<idx_t> before(run_count);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		upper[run_idx] = MinValue(counts[run_idx], lower[run_idx] + rank - start);
+	}
+	// Every pivot comes after all previous pivots that were in the partition, and before all previous pivots that
+	// were not. The number of rows of a run that come before the pivot is therefore between the counts of the
+	// closest previous pivots, which narrows down the binary searches as the search spaces shrink
+	vector<idx_t> before_lower(lower);
+	vector<idx_t> before_upper(counts.begin(), counts.begin() + run_count);
+	while (true) {
+		// Use the middle of the largest search space as the pivot
+		idx_t pivot_run = 0;
+		idx_t max_search_space = 0;
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			if (upper[run_idx] - lower[run_idx] > max_search_space) {
+				max_search_space = upper[run_idx] - lower[run_idx];
+				pivot_run = run_idx;
+			}
 		}
-		const bool l_done = l.block_idx == l_sorted_block.radix_sorting_data.size();
-		const bool r_done = r.block_idx == r_sorted_block.radix_sorting_data.size();
-		if (l_done || r_done) {
-			// One of the sides is exhausted, no need to compare
+		if (max_search_space == 0) {
 			break;
 		}
-		// Pin the radix sorting data
-		if (!l_done) {
-			left->PinRadix(l.block_idx);
-			l_radix_ptr = left->RadixPtr();
-		}
-		if (!r_done) {
-			right->PinRadix(r.block_idx);
-			r_radix_ptr = right->RadixPtr();
+		const idx_t pivot_idx = lower[pivot_run] + max_search_space / 2;
+		// Compute the rank of the pivot (rows that were in previous partitions come before it)
+		idx_t pivot_rank = 0;
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			if (run_idx == pivot_run) {
+				before[run_idx] = pivot_idx;
+			} else {
+				before[run_idx] =
+				    CountBefore(run_idx, before_lower[run_idx], before_upper[run_idx], pivot_run, pivot_idx);
+			}
+			pivot_rank += before[run_idx];
 		}
-		const idx_t &l_count = !l_done ? l_sorted_block.radix_sorting_data[l.block_idx]->count : 0;
-		const idx_t &r_count = !r_done ? r_sorted_block.radix_sorting_data[r.block_idx]->count : 0;
-		// Compute the merge
-		if (sort_layout.all_constant) {
-			// All sorting columns are constant size
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] = FastMemcmp(l_radix_ptr, r_radix_ptr, sort_layout.comparison_size) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
+		if (pivot_rank < rank) {
+			// The pivot (and everything that comes before it) is in this partition
+			for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+				lower[run_idx] = MaxValue(lower[run_idx], before[run_idx]);
 			}
+			lower[pivot_run] = pivot_idx + 1;
+			before_lower = before;
+			before_lower[pivot_run] = pivot_idx + 1;
 		} else {
-			// Pin the blob data
-			if (!l_done) {
-				left->PinData(*l_sorted_block.blob_sorting_data);
-			}
-			if (!r_done) {
-				right->PinData(*r_sorted_block.blob_sorting_data);
+			// The pivot (and everything that comes after it) is not in this partition
+			for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+				upper[run_idx] = MinValue(upper[run_idx], before[run_idx]);
 			}
-			// Merge with variable size sorting columns
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] =
-				    Comparators::CompareTuple(*left, *right, l_radix_ptr, r_radix_ptr, sort_layout, state.external) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
+			upper[pivot_run] = pivot_idx;
+			before_upper = before;
+		}
+	}
+	ends = std::move(lower);
+#ifdef DEBUG
+	idx_t end = 0;
+	for (auto &run_end : ends) {
+		end += run_end;
+	}
+	D_ASSERT(end == rank);
+#endif
+}
+
+void MergeSorter::SaveIndices() {
+	saved_block_indices.resize(runs.size());
+	saved_entry_indices.resize(runs.size());
+	for (idx_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+		saved_block_indices[run_idx] = runs[run_idx]->block_idx;
+		saved_entry_indices[run_idx] = runs[run_idx]->entry_idx;
+	}
+}
+
+void MergeSorter::RestoreIndices() {
+	for (idx_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+		runs[run_idx]->SetIndices(saved_block_indices[run_idx], saved_entry_indices[run_idx]);
+	}
+}
+
+bool MergeSorter::PinNextRow(SBScanState &scan) {
+	auto &blocks = scan.sb->radix_sorting_data;
+	while (scan.block_idx < blocks.size() && scan.entry_idx == blocks[scan.block_idx]->count) {
+		scan.block_idx++;
+		scan.entry_idx = 0;
+	}
+	if (scan.block_idx == blocks.size()) {
+		return false;
+	}
+	scan.PinRadix(scan.block_idx);
+	if (!sort_layout.all_constant) {
+		scan.PinData(*scan.sb->blob_sorting_data);
+	}
+	return true;
+}
+
+bool MergeSorter::RunIsSmaller(const idx_t l, const idx_t r) {
+	if (!run_ptrs[l] || !run_ptrs[r]) {
+		// Exhausted runs come last
+		return run_ptrs[l] && !run_ptrs[r];
+	}
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(run_ptrs[l], run_ptrs[r], sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(*runs[l], *runs[r], run_ptrs[l], run_ptrs[r], sort_layout, state.external);
+	}
+	return comp_res < 0 || (comp_res == 0 && l < r);
+}
+
+idx_t MergeSorter::InitializeLoserTree(const idx_t node) {
+	const idx_t run_count = runs.size();
+	if (node >= run_count) {
+		// Leaf
+		return node - run_count;
+	}
+	const idx_t l_winner = InitializeLoserTree(2 * node);
+	const idx_t r_winner = InitializeLoserTree(2 * node + 1);
+	if (RunIsSmaller(l_winner, r_winner)) {
+		losers[node] = r_winner;
+		return l_winner;
+	} else {
+		losers[node] = l_winner;
+		return r_winner;
+	}
+}
+
+void MergeSorter::ComputeMerge(const idx_t &count, idx_t run_indices[]) {
+	const idx_t run_count = runs.size();
+	// Save indices to restore afterwards
+	SaveIndices();
+	// Pin the next row of each run
+	run_ptrs.resize(run_count);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto &run = *runs[run_idx];
+		run_ptrs[run_idx] = PinNextRow(run) ? run.RadixPtr() : nullptr;
+	}
+	// Build a loser tree: each inner node holds the run that lost the comparison there, the root the overall winner
+	losers.resize(run_count);
+	idx_t winner = InitializeLoserTree(1);
+	// Compute the merge of the next 'count' tuples
+	for (idx_t i = 0; i < count; i++) {
+		D_ASSERT(run_ptrs[winner]);
+		run_indices[i] = winner;
+		// Advance the winning run
+		auto &run = *runs[winner];
+		run.entry_idx++;
+		if (run.entry_idx < run.sb->radix_sorting_data[run.block_idx]->count) {
+			run_ptrs[winner] += sort_layout.entry_size;
+		} else {
+			run_ptrs[winner] = PinNextRow(run) ? run.RadixPtr() : nullptr;
+		}
+		// Replay the matches on the path from the winning run to the root
+		for (idx_t node = (winner + run_count) / 2; node > 0; node /= 2) {
+			if (RunIsSmaller(losers[node], winner)) {
+				std::swap(losers[node], winner);
 			}
 		}
 	}
 	// Reset block indices
-	left->SetIndices(l_block_idx_before, l_entry_idx_before);
-	right->SetIndices(r_block_idx_before, r_entry_idx_before);
+	RestoreIndices();
 }
 
-void MergeSorter::MergeRadix(const idx_t &count, const bool left_smaller[]) {
-	auto &l = *left;
-	auto &r = *right;
+void MergeSorter::MergeRadix(const idx_t &count, const idx_t run_indices[]) {
 	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-
-	auto &l_blocks = l.sb->radix_sorting_data;
-	auto &r_blocks = r.sb->radix_sorting_data;
-	RowDataBlock *l_block = nullptr;
-	RowDataBlock *r_block = nullptr;
-
-	data_ptr_t l_ptr;
-	data_ptr_t r_ptr;
+	SaveIndices();
 
 	RowDataBlock *result_block = result->radix_sorting_data.back().get();
 	auto result_handle = buffer_manager.Pin(result_block->block);
@@ -346,81 +403,41 @@ void MergeSorter::MergeRadix(const idx_t &count, const bool left_smaller[]) {
 
 	idx_t copied = 0;
 	while (copied < count) {
-		// Move to the next block (if needed)
-		if (l.block_idx < l_blocks.size() && l.entry_idx == l_blocks[l.block_idx]->count) {
-			// Delete reference to previous block
-			l_blocks[l.block_idx]->block = nullptr;
-			// Advance block
-			l.block_idx++;
-			l.entry_idx = 0;
+		// Find the consecutive tuples that come from the same run
+		const idx_t run_idx = run_indices[copied];
+		idx_t next = copied + 1;
+		while (next < count && run_indices[next] == run_idx) {
+			next++;
 		}
-		if (r.block_idx < r_blocks.size() && r.entry_idx == r_blocks[r.block_idx]->count) {
+		auto &run = *runs[run_idx];
+		auto &blocks = run.sb->radix_sorting_data;
+		// Move to the next block (if needed)
+		while (run.entry_idx == blocks[run.block_idx]->count) {
 			// Delete reference to previous block
-			r_blocks[r.block_idx]->block = nullptr;
+			blocks[run.block_idx]->block = nullptr;
 			// Advance block
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_blocks.size();
-		const bool r_done = r.block_idx == r_blocks.size();
-		// Pin the radix sortable blocks
-		idx_t l_count;
-		if (!l_done) {
-			l_block = l_blocks[l.block_idx].get();
-			left->PinRadix(l.block_idx);
-			l_ptr = l.RadixPtr();
-			l_count = l_block->count;
-		} else {
-			l_count = 0;
-		}
-		idx_t r_count;
-		if (!r_done) {
-			r_block = r_blocks[r.block_idx].get();
-			r.PinRadix(r.block_idx);
-			r_ptr = r.RadixPtr();
-			r_count = r_block->count;
-		} else {
-			r_count = 0;
-		}
-		// Copy using computed merge
-		if (!l_done && !r_done) {
-			// Both sides have data - merge
-			MergeRows(l_ptr, l.entry_idx, l_count, r_ptr, r.entry_idx, r_count, *result_block, result_ptr,
-			          sort_layout.entry_size, left_smaller, copied, count);
-		} else if (r_done) {
-			// Right side is exhausted
-			FlushRows(l_ptr, l.entry_idx, l_count, *result_block, result_ptr, sort_layout.entry_size, copied, count);
-		} else {
-			// Left side is exhausted
-			FlushRows(r_ptr, r.entry_idx, r_count, *result_block, result_ptr, sort_layout.entry_size, copied, count);
+			run.block_idx++;
+			run.entry_idx = 0;
 		}
+		// Pin the radix sortable block and copy
+		run.PinRadix(run.block_idx);
+		data_ptr_t source_ptr = run.RadixPtr();
+		FlushRows(source_ptr, run.entry_idx, blocks[run.block_idx]->count, *result_block, result_ptr,
+		          sort_layout.entry_size, copied, next);
 	}
 	// Reset block indices
-	left->SetIndices(l_block_idx_before, l_entry_idx_before);
-	right->SetIndices(r_block_idx_before, r_entry_idx_before);
+	RestoreIndices();
 }
 
-void MergeSorter::MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-                            const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices) {
-	auto &l = *left;
-	auto &r = *right;
+void MergeSorter::MergeData(SortedData &result_data, const SortedDataType &type, const idx_t &count,
+                            const idx_t run_indices[], bool reset_indices) {
 	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
+	SaveIndices();
 
 	const auto &layout = result_data.layout;
 	const idx_t row_width = layout.GetRowWidth();
 	const idx_t heap_pointer_offset = layout.GetHeapOffset();
 
-	// Left and right row data to merge
-	data_ptr_t l_ptr;
-	data_ptr_t r_ptr;
-	// Accompanying left and right heap data (if needed)
-	data_ptr_t l_heap_ptr;
-	data_ptr_t r_heap_ptr;
-
 	// Result rows to write to
 	RowDataBlock *result_data_block = result_data.data_blocks.back().get();
 	auto result_data_handle = buffer_manager.Pin(result_data_block->block);
@@ -437,172 +454,49 @@ void MergeSorter::MergeData(SortedData &result_data, SortedData &l_data, SortedD
 
 	idx_t copied = 0;
 	while (copied < count) {
-		// Move to new data blocks (if needed)
-		if (l.block_idx < l_data.data_blocks.size() && l.entry_idx == l_data.data_blocks[l.block_idx]->count) {
-			// Delete reference to previous block
-			l_data.data_blocks[l.block_idx]->block = nullptr;
-			if (!layout.AllConstant() && state.external) {
-				l_data.heap_blocks[l.block_idx]->block = nullptr;
-			}
-			// Advance block
-			l.block_idx++;
-			l.entry_idx = 0;
+		// Find the consecutive tuples that come from the same run
+		const idx_t run_idx = run_indices[copied];
+		idx_t next = copied + 1;
+		while (next < count && run_indices[next] == run_idx) {
+			next++;
 		}
-		if (r.block_idx < r_data.data_blocks.size() && r.entry_idx == r_data.data_blocks[r.block_idx]->count) {
+		auto &run = *runs[run_idx];
+		auto &source_data = type == SortedDataType::BLOB ? *run.sb->blob_sorting_data : *run.sb->payload_data;
+		// Move to new data blocks (if needed)
+		while (run.entry_idx == source_data.data_blocks[run.block_idx]->count) {
 			// Delete reference to previous block
-			r_data.data_blocks[r.block_idx]->block = nullptr;
+			source_data.data_blocks[run.block_idx]->block = nullptr;
 			if (!layout.AllConstant() && state.external) {
-				r_data.heap_blocks[r.block_idx]->block = nullptr;
+				source_data.heap_blocks[run.block_idx]->block = nullptr;
 			}
 			// Advance block
-			r.block_idx++;
-			r.entry_idx = 0;
+			run.block_idx++;
+			run.entry_idx = 0;
 		}
-		const bool l_done = l.block_idx == l_data.data_blocks.size();
-		const bool r_done = r.block_idx == r_data.data_blocks.size();
 		// Pin the row data blocks
-		if (!l_done) {
-			l.PinData(l_data);
-			l_ptr = l.DataPtr(l_data);
-		}
-		if (!r_done) {
-			r.PinData(r_data);
-			r_ptr = r.DataPtr(r_data);
-		}
-		const idx_t &l_count = !l_done ? l_data.data_blocks[l.block_idx]->count : 0;
-		const idx_t &r_count = !r_done ? r_data.data_blocks[r.block_idx]->count : 0;
-		// Perform the merge
+		run.PinData(source_data);
+		data_ptr_t source_data_ptr = run.DataPtr(source_data);
+		const idx_t &source_count = source_data.data_blocks[run.block_idx]->count;
 		if (layout.AllConstant() || !state.external) {
 			// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
-			if (!l_done && !r_done) {
-				// Both sides have data - merge
-				MergeRows(l_ptr, l.entry_idx, l_count, r_ptr, r.entry_idx, r_count, *result_data_block, result_data_ptr,
-				          row_width, left_smaller, copied, count);
-			} else if (r_done) {
-				// Right side is exhausted
-				FlushRows(l_ptr, l.entry_idx, l_count, *result_data_block, result_data_ptr, row_width, copied, count);
-			} else {
-				// Left side is exhausted
-				FlushRows(r_ptr, r.entry_idx, r_count, *result_data_block, result_data_ptr, row_width, copied, count);
-			}
+			FlushRows(source_data_ptr, run.entry_idx, source_count, *result_data_block, result_data_ptr, row_width,
+			          copied, next);
 		} else {
 			// External sorting with variable size data. Pin the heap blocks too
-			if (!l_done) {
-				l_heap_ptr = l.BaseHeapPtr(l_data) + Load<idx_t>(l_ptr + heap_pointer_offset);
-				D_ASSERT(l_heap_ptr - l.BaseHeapPtr(l_data) >= 0);
-				D_ASSERT((idx_t)(l_heap_ptr - l.BaseHeapPtr(l_data)) < l_data.heap_blocks[l.block_idx]->byte_offset);
-			}
-			if (!r_done) {
-				r_heap_ptr = r.BaseHeapPtr(r_data) + Load<idx_t>(r_ptr + heap_pointer_offset);
-				D_ASSERT(r_heap_ptr - r.BaseHeapPtr(r_data) >= 0);
-				D_ASSERT((idx_t)(r_heap_ptr - r.BaseHeapPtr(r_data)) < r_data.heap_blocks[r.block_idx]->byte_offset);
-			}
-			// Both the row and heap data need to be dealt with
-			if (!l_done && !r_done) {
-				// Both sides have data - merge
-				idx_t l_idx_copy = l.entry_idx;
-				idx_t r_idx_copy = r.entry_idx;
-				data_ptr_t result_data_ptr_copy = result_data_ptr;
-				idx_t copied_copy = copied;
-				// Merge row data
-				MergeRows(l_ptr, l_idx_copy, l_count, r_ptr, r_idx_copy, r_count, *result_data_block,
-				          result_data_ptr_copy, row_width, left_smaller, copied_copy, count);
-				const idx_t merged = copied_copy - copied;
-				// Compute the entry sizes and number of heap bytes that will be copied
-				idx_t copy_bytes = 0;
-				data_ptr_t l_heap_ptr_copy = l_heap_ptr;
-				data_ptr_t r_heap_ptr_copy = r_heap_ptr;
-				for (idx_t i = 0; i < merged; i++) {
-					// Store base heap offset in the row data
-					Store<idx_t>(result_heap_block->byte_offset + copy_bytes, result_data_ptr + heap_pointer_offset);
-					result_data_ptr += row_width;
-					// Compute entry size and add to total
-					const bool &l_smaller = left_smaller[copied + i];
-					const bool r_smaller = !l_smaller;
-					auto &entry_size = next_entry_sizes[copied + i];
-					entry_size =
-					    l_smaller * Load<uint32_t>(l_heap_ptr_copy) + r_smaller * Load<uint32_t>(r_heap_ptr_copy);
-					D_ASSERT(entry_size >= sizeof(uint32_t));
-					D_ASSERT(l_heap_ptr_copy - l.BaseHeapPtr(l_data) + l_smaller * entry_size <=
-					         l_data.heap_blocks[l.block_idx]->byte_offset);
-					D_ASSERT(r_heap_ptr_copy - r.BaseHeapPtr(r_data) + r_smaller * entry_size <=
-					         r_data.heap_blocks[r.block_idx]->byte_offset);
-					l_heap_ptr_copy += l_smaller * entry_size;
-					r_heap_ptr_copy += r_smaller * entry_size;
-					copy_bytes += entry_size;
-				}
-				// Reallocate result heap block size (if needed)
-				if (result_heap_block->byte_offset + copy_bytes > result_heap_block->capacity) {
-					idx_t new_capacity = result_heap_block->byte_offset + copy_bytes;
-					buffer_manager.ReAllocate(result_heap_block->block, new_capacity);
-					result_heap_block->capacity = new_capacity;
-					result_heap_ptr = result_heap_handle.Ptr() + result_heap_block->byte_offset;
-				}
-				D_ASSERT(result_heap_block->byte_offset + copy_bytes <= result_heap_block->capacity);
-				// Now copy the heap data
-				for (idx_t i = 0; i < merged; i++) {
-					const bool &l_smaller = left_smaller[copied + i];
-					const bool r_smaller = !l_smaller;
-					const auto &entry_size = next_entry_sizes[copied + i];
-					memcpy(result_heap_ptr,
-					       reinterpret_cast<data_ptr_t>(l_smaller * CastPointerToValue(l_heap_ptr) +
-					                                    r_smaller * CastPointerToValue(r_heap_ptr)),
-					       entry_size);
-					D_ASSERT(Load<uint32_t>(result_heap_ptr) == entry_size);
-					result_heap_ptr += entry_size;
-					l_heap_ptr += l_smaller * entry_size;
-					r_heap_ptr += r_smaller * entry_size;
-					l.entry_idx += l_smaller;
-					r.entry_idx += r_smaller;
-				}
-				// Update result indices and pointers
-				result_heap_block->count += merged;
-				result_heap_block->byte_offset += copy_bytes;
-				copied += merged;
-			} else if (r_done) {
-				// Right side is exhausted - flush left
-				FlushBlobs(layout, l_count, l_ptr, l.entry_idx, l_heap_ptr, *result_data_block, result_data_ptr,
-				           *result_heap_block, result_heap_handle, result_heap_ptr, copied, count);
-			} else {
-				// Left side is exhausted - flush right
-				FlushBlobs(layout, r_count, r_ptr, r.entry_idx, r_heap_ptr, *result_data_block, result_data_ptr,
-				           *result_heap_block, result_heap_handle, result_heap_ptr, copied, count);
-			}
+			data_ptr_t source_heap_ptr =
+			    run.BaseHeapPtr(source_data) + Load<idx_t>(source_data_ptr + heap_pointer_offset);
+			D_ASSERT((idx_t)(source_heap_ptr - run.BaseHeapPtr(source_data)) <
+			         source_data.heap_blocks[run.block_idx]->byte_offset);
+			FlushBlobs(layout, source_count, source_data_ptr, run.entry_idx, source_heap_ptr, *result_data_block,
+			           result_data_ptr, *result_heap_block, result_heap_handle, result_heap_ptr, copied, next);
 			D_ASSERT(result_data_block->count == result_heap_block->count);
 		}
 	}
 	if (reset_indices) {
-		left->SetIndices(l_block_idx_before, l_entry_idx_before);
-		right->SetIndices(r_block_idx_before, r_entry_idx_before);
+		RestoreIndices();
 	}
 }
 
-void MergeSorter::MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr,
-                            idx_t &r_entry_idx, const idx_t &r_count, RowDataBlock &target_block,
-                            data_ptr_t &target_ptr, const idx_t &entry_size, const bool left_smaller[], idx_t &copied,
-                            const idx_t &count) {
-	const idx_t next = MinValue(count - copied, target_block.capacity - target_block.count);
-	idx_t i;
-	for (i = 0; i < next && l_entry_idx < l_count && r_entry_idx < r_count; i++) {
-		const bool &l_smaller = left_smaller[copied + i];
-		const bool r_smaller = !l_smaller;
-		// Use comparison bool (0 or 1) to copy an entry from either side
-		FastMemcpy(
-		    target_ptr,
-		    reinterpret_cast<data_ptr_t>(l_smaller * CastPointerToValue(l_ptr) + r_smaller * CastPointerToValue(r_ptr)),
-		    entry_size);
-		target_ptr += entry_size;
-		// Use the comparison bool to increment entries and pointers
-		l_entry_idx += l_smaller;
-		r_entry_idx += r_smaller;
-		l_ptr += l_smaller * entry_size;
-		r_ptr += r_smaller * entry_size;
-	}
-	// Update counts
-	target_block.count += i;
-	copied += i;
-}
-
 void MergeSorter::FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
                             RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
                             const idx_t &count) {
@@ -5,7 +5,121 @@
 
 namespace duckdb {
 
-//! Calls std::sort on strings that are tied by their prefix after the radix sort
+//! A string that is tied by its prefix, and the sorting entry it belongs to
+struct TiedString {
+	data_ptr_t entry;
+	string_t value;
+};
+
+//! Returns the radix of a string at the given depth (0 if the string has ended)
+static inline idx_t StringRadix(const TiedString &str, const idx_t &depth) {
+	return depth < str.value.GetSize() ? const_data_ptr_cast(str.value.GetData())[depth] + 1 : 0;
+}
+
+//! Compares two strings, starting at the given depth
+static inline int CompareTiedStrings(const TiedString &l, const TiedString &r, const idx_t &depth) {
+	const auto l_size = l.value.GetSize();
+	const auto r_size = r.value.GetSize();
+	const auto min_size = MinValue<idx_t>(l_size, r_size);
+	if (min_size > depth) {
+		auto result = memcmp(l.value.GetData() + depth, r.value.GetData() + depth, min_size - depth);
+		if (result != 0) {
+			return result;
+		}
+	}
+	return l_size == r_size ? 0 : (l_size < r_size ? -1 : 1);
+}
+
+//! Returns the length of the prefix (starting at depth) that all strings have in common
+static idx_t CommonStringPrefix(const TiedString strings[], const idx_t &count, const idx_t &depth) {
+	const auto first = const_data_ptr_cast(strings[0].value.GetData());
+	idx_t prefix_length = strings[0].value.GetSize() - depth;
+	for (idx_t i = 1; i < count && prefix_length > 0; i++) {
+		const auto &str = strings[i].value;
+		const auto other = const_data_ptr_cast(str.GetData());
+		prefix_length = MinValue<idx_t>(prefix_length, str.GetSize() - depth);
+		for (idx_t j = 0; j < prefix_length; j++) {
+			if (first[depth + j] != other[depth + j]) {
+				prefix_length = j;
+				break;
+			}
+		}
+	}
+	return prefix_length;
+}
+
+//! MSD radix sort over the full (variable-length) strings that breaks ties between strings with a shared prefix.
+//! Prefixes that all strings have in common are skipped at once, so long shared prefixes do not need a pass per byte.
+static void RadixSortTiedStrings(TiedString strings[], TiedString temp[], idx_t count, idx_t depth, idx_t level) {
+	static constexpr idx_t MAX_RECURSION_LEVEL = 64;
+	idx_t counts[SortConstants::MSD_RADIX_LOCATIONS];
+	while (true) {
+		if (count <= SortConstants::INSERTION_SORT_THRESHOLD || level > MAX_RECURSION_LEVEL) {
+			std::sort(strings, strings + count, [&depth](const TiedString &l, const TiedString &r) {
+				return CompareTiedStrings(l, r, depth) < 0;
+			});
+			return;
+		}
+		// Collect counts
+		memset(counts, 0, sizeof(counts));
+		for (idx_t i = 0; i < count; i++) {
+			counts[StringRadix(strings[i], depth)]++;
+		}
+		idx_t max_count = 0;
+		for (idx_t radix = 0; radix < SortConstants::MSD_RADIX_LOCATIONS; radix++) {
+			max_count = MaxValue<idx_t>(max_count, counts[radix]);
+		}
+		if (max_count != count) {
+			break;
+		}
+		if (counts[0] == count) {
+			// All strings have ended: they are equal
+			return;
+		}
+		// All strings have the same byte here: skip the prefix they have in common
+		depth += CommonStringPrefix(strings, count, depth);
+	}
+	// Compute locations from counts, and re-order the strings
+	idx_t locations[SortConstants::MSD_RADIX_LOCATIONS];
+	locations[0] = 0;
+	for (idx_t radix = 1; radix < SortConstants::MSD_RADIX_LOCATIONS; radix++) {
+		locations[radix] = locations[radix - 1] + counts[radix - 1];
+	}
+	for (idx_t i = 0; i < count; i++) {
+		temp[locations[StringRadix(strings[i], depth)]++] = strings[i];
+	}
+	std::copy(temp, temp + count, strings);
+	// Recurse into the buckets (the strings in the first bucket have ended, and are equal)
+	idx_t bucket_start = counts[0];
+	for (idx_t radix = 1; radix < SortConstants::MSD_RADIX_LOCATIONS; radix++) {
+		if (counts[radix] > 1) {
+			RadixSortTiedStrings(strings + bucket_start, temp + bucket_start, counts[radix], depth + 1, level + 1);
+		}
+		bucket_start += counts[radix];
+	}
+}
+
+//! Sorts the entries of strings that are tied by their prefix on the full strings in the blob
+static void SortTiedStrings(data_ptr_t entry_ptrs[], const idx_t &count, const data_ptr_t blob_ptr,
+                            const idx_t &row_width, const idx_t &tie_col_offset, const idx_t &prefix_length,
+                            const SortLayout &sort_layout, const bool &descending) {
+	auto strings_ptr = make_unsafe_uniq_array<TiedString>(count * 2);
+	auto strings = strings_ptr.get();
+	idx_t depth = prefix_length;
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t blob_idx = Load<uint32_t>(entry_ptrs[i] + sort_layout.comparison_size);
+		strings[i].entry = entry_ptrs[i];
+		strings[i].value = Load<string_t>(blob_ptr + blob_idx * row_width + tie_col_offset);
+		// The radix sort has sorted the prefix (with strings that are shorter than the prefix padded with zeroes)
+		depth = MinValue<idx_t>(depth, strings[i].value.GetSize());
+	}
+	RadixSortTiedStrings(strings, strings + count, count, depth, 0);
+	for (idx_t i = 0; i < count; i++) {
+		entry_ptrs[descending ? count - i - 1 : i] = strings[i].entry;
+	}
+}
+
+//! Sorts rows that are tied by the prefix of a blob column after the radix sort on their full values
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
 	const auto row_width = sort_layout.blob_layout.GetRowWidth();
@@ -28,15 +142,22 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
-	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
-		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
-		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
-		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
-		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
-	          });
+	if (logical_type.InternalType() == PhysicalType::VARCHAR) {
+		// Strings: continue the radix sort past the prefix
+		const auto prefix_length = sort_layout.prefix_lengths[tie_col];
+		SortTiedStrings(entry_ptrs, end - start, blob_ptr, row_width, tie_col_offset, prefix_length, sort_layout,
+		                order == -1);
+	} else {
+		std::sort(entry_ptrs, entry_ptrs + end - start,
+		          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
+		                                                                                        const data_ptr_t r) {
+			          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
+			          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
+			          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
+			          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
+			          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          });
+	}
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
 	data_ptr_t temp_ptr = temp_block.get();
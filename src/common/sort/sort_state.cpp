@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <algorithm>
 #include <numeric>
@@ -358,7 +359,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(2), group_idx(0), num_groups(0) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -424,23 +425,47 @@ void GlobalSortState::PrepareMergePhase() {
 	}
 }
 
+idx_t GlobalSortState::GetMergeFanIn() const {
+	idx_t fan_in = MinValue<idx_t>(sorted_blocks.size(), SortConstants::MAX_MERGE_FAN_IN);
+	if (external) {
+		// A merge task keeps the radix, blob and payload blocks (and their heaps) of each of the sorted blocks that it
+		// merges pinned, plus the blocks that it writes to
+		idx_t max_block_size = 0;
+		idx_t total_count = 0;
+		for (auto &sb : sorted_blocks) {
+			max_block_size = MaxValue(max_block_size, sb->MaxBlockSizeInBytes());
+			total_count += sb->Count();
+		}
+		// Only as many threads as there are partitions to merge are active at the same time
+		const idx_t partition_count = (total_count + block_capacity - 1) / MaxValue<idx_t>(block_capacity, 1);
+		auto &scheduler = TaskScheduler::GetScheduler(buffer_manager.GetDatabase());
+		const idx_t thread_count = MaxValue<idx_t>(MinValue<idx_t>(scheduler.NumberOfThreads(), partition_count), 1);
+		// Limit the fan-in so that the merge tasks of all threads still fit comfortably in memory
+		const idx_t thread_budget = buffer_manager.GetMaxMemory() / 8 / thread_count;
+		const idx_t pinned_blocks = thread_budget / MaxValue<idx_t>(max_block_size, 1);
+		fan_in = MinValue(fan_in, pinned_blocks > 1 ? pinned_blocks - 1 : 0);
+	}
+	return MaxValue<idx_t>(fan_in, 2);
+}
+
 void GlobalSortState::InitializeMergeRound() {
 	D_ASSERT(sorted_blocks_temp.empty());
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// Merge as many blocks at once as we can, so the data is read and written fewer times
+	merge_fan_in = GetMergeFanIn();
+	// A single block is left over - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	group_idx = 0;
+	num_groups = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
+	run_starts.assign(merge_fan_in, 0);
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t g_idx = 0; g_idx < num_groups; g_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
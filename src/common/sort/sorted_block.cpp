@@ -200,15 +200,28 @@ idx_t SortedBlock::HeapSize() const {
 idx_t SortedBlock::SizeInBytes() const {
 	idx_t bytes = 0;
 	for (idx_t i = 0; i < radix_sorting_data.size(); i++) {
-		bytes += radix_sorting_data[i]->capacity * sort_layout.entry_size;
-		if (!sort_layout.all_constant) {
-			bytes += blob_sorting_data->data_blocks[i]->capacity * sort_layout.blob_layout.GetRowWidth();
-			bytes += blob_sorting_data->heap_blocks[i]->capacity;
-		}
-		bytes += payload_data->data_blocks[i]->capacity * payload_layout.GetRowWidth();
-		if (!payload_layout.AllConstant()) {
-			bytes += payload_data->heap_blocks[i]->capacity;
-		}
+		bytes += BlockSizeInBytes(i);
+	}
+	return bytes;
+}
+
+idx_t SortedBlock::MaxBlockSizeInBytes() const {
+	idx_t bytes = 0;
+	for (idx_t i = 0; i < radix_sorting_data.size(); i++) {
+		bytes = MaxValue(bytes, BlockSizeInBytes(i));
+	}
+	return bytes;
+}
+
+idx_t SortedBlock::BlockSizeInBytes(idx_t block_idx) const {
+	idx_t bytes = radix_sorting_data[block_idx]->capacity * sort_layout.entry_size;
+	if (!sort_layout.all_constant) {
+		bytes += blob_sorting_data->data_blocks[block_idx]->capacity * sort_layout.blob_layout.GetRowWidth();
+		bytes += blob_sorting_data->heap_blocks[block_idx]->capacity;
+	}
+	bytes += payload_data->data_blocks[block_idx]->capacity * payload_layout.GetRowWidth();
+	if (!payload_layout.AllConstant()) {
+		bytes += payload_data->heap_blocks[block_idx]->capacity;
 	}
 	return bytes;
 }
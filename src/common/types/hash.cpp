@@ -64,7 +64,7 @@ hash_t Hash(const char *str) {
 
 template <>
 hash_t Hash(string_t val) {
-	return Hash(val.GetData(), val.GetSize());
+	return HashString(val);
 }
 
 template <>
@@ -76,9 +76,9 @@ hash_t Hash(char *val) {
 // Copyright (c) 2018-2021 Martin Ankerl
 // https://github.com/martinus/robin-hood-hashing/blob/3.11.5/LICENSE
 hash_t HashBytes(void *ptr, size_t len) noexcept {
-	static constexpr uint64_t M = UINT64_C(0xc6a4a7935bd1e995);
-	static constexpr uint64_t SEED = UINT64_C(0xe17a1465);
-	static constexpr unsigned int R = 47;
+	static constexpr uint64_t M = StringHashConstants::M;
+	static constexpr uint64_t SEED = StringHashConstants::SEED;
+	static constexpr unsigned int R = StringHashConstants::R;
 
 	auto const *const data64 = static_cast<uint64_t const *>(ptr);
 	uint64_t h = SEED ^ (len * M);
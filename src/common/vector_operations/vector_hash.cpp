@@ -11,12 +11,23 @@
 
 namespace duckdb {
 
+template <class T>
+static inline hash_t HashValue(const T &input) {
+	return duckdb::Hash<T>(input);
+}
+
+template <>
+inline hash_t HashValue(const string_t &input) {
+	// inline the hash of short strings into the hash loops
+	return input.IsInlined() ? HashInlinedString(input) : duckdb::Hash<string_t>(input);
+}
+
 struct HashOp {
 	static const hash_t NULL_HASH = 0xbf58476d1ce4e5b9;
 
 	template <class T>
 	static inline hash_t Operation(T input, bool is_null) {
-		return is_null ? NULL_HASH : duckdb::Hash<T>(input);
+		return is_null ? NULL_HASH : HashValue<T>(input);
 	}
 };
 
@@ -37,7 +48,7 @@ static inline void TightLoopHash(const T *__restrict ldata, hash_t *__restrict r
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			result_data[ridx] = duckdb::Hash<T>(ldata[idx]);
+			result_data[ridx] = HashValue<T>(ldata[idx]);
 		}
 	}
 }
@@ -254,7 +265,7 @@ static inline void TightLoopCombineHashConstant(const T *__restrict ldata, hash_
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			auto other_hash = duckdb::Hash<T>(ldata[idx]);
+			auto other_hash = HashValue<T>(ldata[idx]);
 			hash_data[ridx] = CombineHashScalar(constant_hash, other_hash);
 		}
 	}
@@ -275,7 +286,7 @@ static inline void TightLoopCombineHash(const T *__restrict ldata, hash_t *__res
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
-			auto other_hash = duckdb::Hash<T>(ldata[idx]);
+			auto other_hash = HashValue<T>(ldata[idx]);
 			hash_data[ridx] = CombineHashScalar(hash_data[ridx], other_hash);
 		}
 	}
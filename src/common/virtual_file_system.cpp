@@ -1,8 +1,11 @@
 #include "duckdb/common/virtual_file_system.hpp"
 
+#include "duckdb/common/compressed_file_system.hpp"
+#include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/gzip_file_system.hpp"
 #include "duckdb/common/pipe_file_system.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -38,6 +41,12 @@ unique_ptr<FileHandle> VirtualFileSystem::OpenFile(const string &path, uint8_t f
 			    "Attempting to open a compressed file, but the compression type is not supported");
 		}
 		file_handle = entry->second->OpenCompressedFile(std::move(file_handle), flags & FileFlags::FILE_FLAGS_WRITE);
+		auto compressed_file = dynamic_cast<CompressedFile *>(file_handle.get());
+		auto context = FileOpener::TryGetClientContext(opener);
+		if (compressed_file && context) {
+			// blocks are decompressed by the threads of the scheduler, so we never use more threads than configured
+			compressed_file->scheduler = &TaskScheduler::GetScheduler(*context);
+		}
 	}
 	return file_handle;
 }
@@ -8,6 +8,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/queue.hpp"
 #include "duckdb/common/field_writer.hpp"
+#include "duckdb/execution/merge_sort_tree.hpp"
 
 #include <algorithm>
 #include <stdlib.h>
@@ -37,6 +38,8 @@ inline interval_t operator-(const interval_t &lhs, const interval_t &rhs) {
 
 using FrameBounds = std::pair<idx_t, idx_t>;
 
+struct QuantileSortTree;
+
 template <typename SAVE_TYPE>
 struct QuantileState {
 	using SaveType = SAVE_TYPE;
@@ -51,7 +54,11 @@ struct QuantileState {
 	// Windowed MAD indirection
 	vector<idx_t> m;
 
-	QuantileState() : pos(0) {
+	// Windowed Quantile sort tree over the whole partition
+	idx_t count;
+	unique_ptr<QuantileSortTree> qst;
+
+	QuantileState() : pos(0), count(0) {
 	}
 
 	~QuantileState() {
@@ -313,6 +320,19 @@ struct Interpolator {
 		}
 	}
 
+	template <class INPUT_TYPE, class TARGET_TYPE, typename ACCESSOR = QuantileDirect<INPUT_TYPE>>
+	TARGET_TYPE Extract(const INPUT_TYPE &lo_t, const INPUT_TYPE &hi_t, Vector &result,
+	                    const ACCESSOR &accessor = ACCESSOR()) const {
+		using ACCESS_TYPE = typename ACCESSOR::RESULT_TYPE;
+		if (CRN == FRN) {
+			return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(lo_t), result);
+		} else {
+			auto lo = CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(lo_t), result);
+			auto hi = CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(hi_t), result);
+			return CastInterpolation::Interpolate<TARGET_TYPE>(lo, RN - FRN, hi);
+		}
+	}
+
 	const bool desc;
 	const double RN;
 	const idx_t FRN;
@@ -365,6 +385,13 @@ struct Interpolator<true> {
 		return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(v_t[FRN]), result);
 	}
 
+	template <class INPUT_TYPE, class TARGET_TYPE, typename ACCESSOR = QuantileDirect<INPUT_TYPE>>
+	TARGET_TYPE Extract(const INPUT_TYPE &lo_t, const INPUT_TYPE &hi_t, Vector &result,
+	                    const ACCESSOR &accessor = ACCESSOR()) const {
+		using ACCESS_TYPE = typename ACCESSOR::RESULT_TYPE;
+		return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(lo_t), result);
+	}
+
 	const bool desc;
 	const idx_t FRN;
 	const idx_t CRN;
@@ -373,6 +400,60 @@ struct Interpolator<true> {
 	idx_t end;
 };
 
+// Windowed quantiles over the whole partition
+// The lowest level holds the included rows sorted by value, so the nth value of a frame
+// is the nth row in the lowest level whose index lies in the frame.
+struct QuantileSortTree : public MergeSortTree<idx_t> {
+	using BaseTree = MergeSortTree<idx_t>;
+
+	//! Narrower frames are cheaper to maintain incrementally than to build the tree for
+	static constexpr idx_t MIN_FRAME_SIZE = 1024;
+
+	explicit QuantileSortTree(Elements &&lowest_level) : BaseTree(std::move(lowest_level)) {
+	}
+
+	template <class INPUT_TYPE>
+	static unique_ptr<QuantileSortTree> WindowInit(const INPUT_TYPE *data, const QuantileIncluded &included,
+	                                               idx_t count) {
+		Elements lowest_level;
+		lowest_level.reserve(count);
+		for (idx_t i = 0; i < count; ++i) {
+			if (included(i)) {
+				lowest_level.emplace_back(i);
+			}
+		}
+
+		using ID = QuantileIndirect<INPUT_TYPE>;
+		ID indirect(data);
+		QuantileCompare<ID> cmp(indirect, false);
+		std::sort(lowest_level.begin(), lowest_level.end(), cmp);
+
+		return make_uniq<QuantileSortTree>(std::move(lowest_level));
+	}
+
+	//! The number of included rows in the frame
+	inline idx_t FrameSize(const FrameBounds &frame) const {
+		return CountRange(frame.first, frame.second);
+	}
+
+	template <typename INPUT_TYPE, typename RESULT_TYPE, bool DISCRETE>
+	RESULT_TYPE WindowScalar(const INPUT_TYPE *data, const FrameBounds &frame, const idx_t n, Vector &result,
+	                         const Value &q) const {
+		D_ASSERT(n > 0);
+
+		Interpolator<DISCRETE> interp(q, n, false);
+		const auto lo_idx = tree[0][SelectNth(frame.first, frame.second, interp.FRN)];
+		auto hi_idx = lo_idx;
+		if (interp.CRN != interp.FRN) {
+			hi_idx = tree[0][SelectNth(frame.first, frame.second, interp.CRN)];
+		}
+
+		using ID = QuantileIndirect<INPUT_TYPE>;
+		ID indirect(data);
+		return interp.template Extract<idx_t, RESULT_TYPE, ID>(lo_idx, hi_idx, result, indirect);
+	}
+};
+
 template <typename T>
 static inline T QuantileAbs(const T &t) {
 	return AbsOperator::Operation<T, T>(t);
@@ -484,6 +565,22 @@ struct QuantileOperation {
 	static bool IgnoreNull() {
 		return true;
 	}
+
+	template <class STATE, class INPUT_TYPE>
+	static void WindowInit(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
+	                       AggregateInputData &aggr_input_data, STATE &state, idx_t count) {
+		state.count = count;
+	}
+
+	//! Whether to select the values from the sort tree, which is built once a frame is too wide
+	template <class STATE, class INPUT_TYPE>
+	static bool UseSortTree(const INPUT_TYPE *data, const QuantileIncluded &included, STATE &state,
+	                        const FrameBounds &frame) {
+		if (!state.qst && state.count && frame.second - frame.first >= QuantileSortTree::MIN_FRAME_SIZE) {
+			state.qst = QuantileSortTree::WindowInit<INPUT_TYPE>(data, included, state.count);
+		}
+		return state.qst != nullptr;
+	}
 };
 
 template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
@@ -519,8 +616,26 @@ struct QuantileScalarOperation : public QuantileOperation {
 		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
 		auto &rmask = FlatVector::Validity(result);
 
+		D_ASSERT(aggr_input_data.bind_data);
+		auto &bind_data = aggr_input_data.bind_data->Cast<QuantileBindData>();
+
+		// Find the two positions needed
+		const auto q = bind_data.quantiles[0];
+
 		QuantileIncluded included(fmask, dmask, bias);
 
+		if (UseSortTree(data, included, state, frame)) {
+			// Select the values from the sort tree over the partition
+			const auto n = state.qst->FrameSize(frame);
+			if (n) {
+				rdata[ridx] = state.qst->template WindowScalar<INPUT_TYPE, RESULT_TYPE, DISCRETE>(data, frame, n,
+				                                                                                    result, q);
+			} else {
+				rmask.Set(ridx, false);
+			}
+			return;
+		}
+
 		//  Lazily initialise frame state
 		auto prev_pos = state.pos;
 		state.SetPos(frame.second - frame.first);
@@ -528,12 +643,6 @@ struct QuantileScalarOperation : public QuantileOperation {
 		auto index = state.w.data();
 		D_ASSERT(index);
 
-		D_ASSERT(aggr_input_data.bind_data);
-		auto &bind_data = aggr_input_data.bind_data->Cast<QuantileBindData>();
-
-		// Find the two positions needed
-		const auto q = bind_data.quantiles[0];
-
 		bool replace = false;
 		if (frame.first == prev.first + 1 && frame.second == prev.second + 1) {
 			//  Fixed frame size
@@ -573,6 +682,7 @@ AggregateFunction GetTypedDiscreteQuantileAggregateFunction(const LogicalType &t
 	using OP = QuantileScalarOperation<true>;
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, type);
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -681,6 +791,21 @@ struct QuantileListOperation : public QuantileOperation {
 		auto &result = ListVector::GetEntry(list);
 		auto rdata = FlatVector::GetData<CHILD_TYPE>(result);
 
+		if (UseSortTree(data, included, state, frame)) {
+			// Select the values from the sort tree over the partition
+			const auto n = state.qst->FrameSize(frame);
+			if (n) {
+				for (const auto &q : bind_data.order) {
+					const auto &quantile = bind_data.quantiles[q];
+					rdata[lentry.offset + q] = state.qst->template WindowScalar<INPUT_TYPE, CHILD_TYPE, DISCRETE>(
+					    data, frame, n, result, quantile);
+				}
+			} else {
+				lmask.Set(lidx, false);
+			}
+			return;
+		}
+
 		//  Lazily initialise frame state
 		auto prev_pos = state.pos;
 		state.SetPos(frame.second - frame.first);
@@ -762,6 +887,7 @@ AggregateFunction GetTypedDiscreteQuantileListAggregateFunction(const LogicalTyp
 	auto fun = QuantileListAggregate<STATE, INPUT_TYPE, list_entry_t, OP>(type, type);
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -819,6 +945,7 @@ AggregateFunction GetTypedContinuousQuantileAggregateFunction(const LogicalType
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, TARGET_TYPE, OP>(input_type, target_type);
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -873,6 +1000,7 @@ AggregateFunction GetTypedContinuousQuantileListAggregateFunction(const LogicalT
 	auto fun = QuantileListAggregate<STATE, INPUT_TYPE, list_entry_t, OP>(input_type, result_type);
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
+	fun.window_init = AggregateFunction::UnaryWindowInit<STATE, INPUT_TYPE, OP>;
 	return fun;
 }
 
@@ -1,4 +1,5 @@
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/fused_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -13,9 +14,16 @@ ExecuteFunctionState::~ExecuteFunctionState() {
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<ExecuteFunctionState>(expr, root);
+	// the functions below a fused function are covered by its program, so we only try to fuse the topmost function
+	bool in_fused_tree = root.in_fused_tree;
+	if (!in_fused_tree) {
+		result->fused_expression = FusedExpression::TryCompile(expr);
+		root.in_fused_tree = result->fused_expression != nullptr;
+	}
 	for (auto &child : expr.children) {
 		result->AddChild(child.get());
 	}
+	root.in_fused_tree = in_fused_tree;
 	result->Finalize();
 	if (expr.function.init_local_state) {
 		result->local_state = expr.function.init_local_state(*result, expr, expr.bind_info.get());
@@ -58,6 +66,18 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
+	auto &fused_expression = state->Cast<ExecuteFunctionState>().fused_expression;
+	bool sampling = false;
+	if (fused_expression && !sel && chunk) {
+		// try to evaluate the whole tree in one pass, without materializing the intermediate results
+		state->profiler.BeginSample();
+		if (fused_expression->TryExecute(*chunk, count, result)) {
+			state->profiler.EndSample(count);
+			return;
+		}
+		// the sample covers the evaluation below as well, so the chunk is only counted once
+		sampling = true;
+	}
 	state->intermediate_chunk.Reset();
 	auto &arguments = state->intermediate_chunk;
 	if (!state->types.empty()) {
@@ -74,7 +94,9 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	}
 	arguments.SetCardinality(count);
 
-	state->profiler.BeginSample();
+	if (!sampling) {
+		state->profiler.BeginSample();
+	}
 	D_ASSERT(expr.function.function);
 	expr.function.function(arguments, *state, result);
 	state->profiler.EndSample(count);
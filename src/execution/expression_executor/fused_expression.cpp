@@ -0,0 +1,289 @@
+#include "duckdb/execution/fused_expression.hpp"
+
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+namespace duckdb {
+
+//! The floating point operators are the same as AddOperator, SubtractOperator and MultiplyOperator, but are defined
+//! inline so the batch loops can be vectorized
+struct FusedAddOperator {
+	template <class TA, class TB, class TR>
+	static inline TR Operation(TA left, TB right) {
+		return left + right;
+	}
+};
+
+struct FusedSubtractOperator {
+	template <class TA, class TB, class TR>
+	static inline TR Operation(TA left, TB right) {
+		return left - right;
+	}
+};
+
+struct FusedMultiplyOperator {
+	template <class TA, class TB, class TR>
+	static inline TR Operation(TA left, TB right) {
+		return left * right;
+	}
+};
+
+static bool IsFusedType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsFusedOperator(const Expression &expr, const LogicalType &type) {
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION || expr.return_type != type) {
+		return false;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.children.size() != 2 || func.bind_info) {
+		return false;
+	}
+	if (func.function.name != "+" && func.function.name != "-" && func.function.name != "*") {
+		return false;
+	}
+	return func.children[0]->return_type == type && func.children[1]->return_type == type;
+}
+
+//! Returns the number of operators in the tree, or DConstants::INVALID_INDEX if the tree cannot be fused
+static idx_t CountFusedOperators(const Expression &expr, const LogicalType &type) {
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_REF:
+		return expr.return_type == type ? 0 : DConstants::INVALID_INDEX;
+	case ExpressionClass::BOUND_CONSTANT:
+		return expr.return_type == type && !expr.Cast<BoundConstantExpression>().value.IsNull()
+		           ? 0
+		           : DConstants::INVALID_INDEX;
+	default:
+		break;
+	}
+	if (!IsFusedOperator(expr, type)) {
+		return DConstants::INVALID_INDEX;
+	}
+	idx_t operator_count = 1;
+	for (auto &child : expr.Cast<BoundFunctionExpression>().children) {
+		auto child_count = CountFusedOperators(*child, type);
+		if (child_count == DConstants::INVALID_INDEX) {
+			return DConstants::INVALID_INDEX;
+		}
+		operator_count += child_count;
+	}
+	return operator_count;
+}
+
+FusedExpression::FusedExpression(PhysicalType type) : type(type) {
+}
+
+unique_ptr<FusedExpression> FusedExpression::TryCompile(const BoundFunctionExpression &expr) {
+	auto &type = expr.return_type;
+	if (!IsFusedType(type)) {
+		return nullptr;
+	}
+	auto operator_count = CountFusedOperators(expr, type);
+	if (operator_count == DConstants::INVALID_INDEX || operator_count < 2 || operator_count > MAX_INSTRUCTIONS) {
+		// a single operator does not materialize any intermediates, so there is nothing to gain by fusing it
+		return nullptr;
+	}
+	auto result = unique_ptr<FusedExpression>(new FusedExpression(type.InternalType()));
+	result->Compile(expr);
+	D_ASSERT(result->instructions.size() == operator_count);
+
+	// every instruction, constant and input column gets a register to hold a batch of values
+	auto register_count = result->instructions.size() + result->constants.size() + result->columns.size();
+	result->registers = make_unsafe_uniq_array<data_t>(register_count * BATCH_SIZE * GetTypeIdSize(result->type));
+	return result;
+}
+
+FusedOperand FusedExpression::Compile(const Expression &expr) {
+	FusedOperand result;
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_REF: {
+		auto column_index = expr.Cast<BoundReferenceExpression>().index;
+		result.type = FusedOperandType::COLUMN;
+		result.index = columns.size();
+		for (idx_t i = 0; i < columns.size(); i++) {
+			if (columns[i] == column_index) {
+				result.index = i;
+				return result;
+			}
+		}
+		columns.push_back(column_index);
+		return result;
+	}
+	case ExpressionClass::BOUND_CONSTANT:
+		result.type = FusedOperandType::CONSTANT;
+		result.index = constants.size();
+		constants.push_back(expr.Cast<BoundConstantExpression>().value);
+		return result;
+	default:
+		break;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	FusedInstruction instruction;
+	if (func.function.name == "+") {
+		instruction.opcode = FusedOpcode::ADD;
+	} else if (func.function.name == "-") {
+		instruction.opcode = FusedOpcode::SUBTRACT;
+	} else {
+		instruction.opcode = FusedOpcode::MULTIPLY;
+	}
+	instruction.left = Compile(*func.children[0]);
+	instruction.right = Compile(*func.children[1]);
+	instructions.push_back(instruction);
+
+	result.type = FusedOperandType::REGISTER;
+	result.index = instructions.size() - 1;
+	return result;
+}
+
+template <class T, class OP>
+static void ExecuteInstruction(const T *__restrict left, const T *__restrict right, T *__restrict target, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		target[i] = OP::template Operation<T, T, T>(left[i], right[i]);
+	}
+}
+
+template <class T>
+static void Broadcast(T *target, T value) {
+	for (idx_t i = 0; i < FusedExpression::BATCH_SIZE; i++) {
+		target[i] = value;
+	}
+}
+
+template <class T, class ADD, class SUBTRACT, class MULTIPLY>
+bool FusedExpression::TemplatedExecute(DataChunk &input, idx_t count, Vector &result) {
+	auto regs = reinterpret_cast<T *>(registers.get());
+	auto constant_regs = regs + instructions.size() * BATCH_SIZE;
+	auto column_regs = constant_regs + constants.size() * BATCH_SIZE;
+
+	// the program only handles flat or constant inputs without NULL values
+	const T *column_data[MAX_INSTRUCTIONS + 1];
+	bool has_flat_input = false;
+	for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+		auto &vector = input.data[columns[col_idx]];
+		switch (vector.GetVectorType()) {
+		case VectorType::FLAT_VECTOR:
+			if (!FlatVector::Validity(vector).AllValid()) {
+				return false;
+			}
+			column_data[col_idx] = FlatVector::GetData<T>(vector);
+			has_flat_input = true;
+			break;
+		case VectorType::CONSTANT_VECTOR:
+			if (ConstantVector::IsNull(vector)) {
+				return false;
+			}
+			Broadcast<T>(column_regs + col_idx * BATCH_SIZE, *ConstantVector::GetData<T>(vector));
+			column_data[col_idx] = nullptr;
+			break;
+		default:
+			return false;
+		}
+	}
+	if (!has_flat_input) {
+		// leave constant inputs to the regular path, which produces a constant result
+		return false;
+	}
+	for (idx_t const_idx = 0; const_idx < constants.size(); const_idx++) {
+		Broadcast<T>(constant_regs + const_idx * BATCH_SIZE, constants[const_idx].GetValueUnsafe<T>());
+	}
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	FlatVector::Validity(result).Reset();
+	auto result_data = FlatVector::GetData<T>(result);
+
+	for (idx_t offset = 0; offset < count; offset += BATCH_SIZE) {
+		auto batch_count = MinValue<idx_t>(BATCH_SIZE, count - offset);
+		const T *operands[2];
+		for (idx_t instr_idx = 0; instr_idx < instructions.size(); instr_idx++) {
+			auto &instruction = instructions[instr_idx];
+			for (idx_t i = 0; i < 2; i++) {
+				auto &operand = i == 0 ? instruction.left : instruction.right;
+				switch (operand.type) {
+				case FusedOperandType::REGISTER:
+					operands[i] = regs + operand.index * BATCH_SIZE;
+					break;
+				case FusedOperandType::CONSTANT:
+					operands[i] = constant_regs + operand.index * BATCH_SIZE;
+					break;
+				default:
+					operands[i] = column_data[operand.index] ? column_data[operand.index] + offset
+					                                         : column_regs + operand.index * BATCH_SIZE;
+					break;
+				}
+			}
+			// the last instruction writes straight into the result
+			auto target = instr_idx + 1 == instructions.size() ? result_data + offset : regs + instr_idx * BATCH_SIZE;
+			switch (instruction.opcode) {
+			case FusedOpcode::ADD:
+				ExecuteInstruction<T, ADD>(operands[0], operands[1], target, batch_count);
+				break;
+			case FusedOpcode::SUBTRACT:
+				ExecuteInstruction<T, SUBTRACT>(operands[0], operands[1], target, batch_count);
+				break;
+			default:
+				ExecuteInstruction<T, MULTIPLY>(operands[0], operands[1], target, batch_count);
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+bool FusedExpression::TryExecute(DataChunk &input, idx_t count, Vector &result) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return TemplatedExecute<int8_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::INT16:
+		return TemplatedExecute<int16_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::INT32:
+		return TemplatedExecute<int32_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::INT64:
+		return TemplatedExecute<int64_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::UINT8:
+		return TemplatedExecute<uint8_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::UINT16:
+		return TemplatedExecute<uint16_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::UINT32:
+		return TemplatedExecute<uint32_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::UINT64:
+		return TemplatedExecute<uint64_t, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+		                        MultiplyOperatorOverflowCheck>(input, count, result);
+	case PhysicalType::FLOAT:
+		return TemplatedExecute<float, FusedAddOperator, FusedSubtractOperator, FusedMultiplyOperator>(input, count,
+		                                                                                               result);
+	case PhysicalType::DOUBLE:
+		return TemplatedExecute<double, FusedAddOperator, FusedSubtractOperator, FusedMultiplyOperator>(input, count,
+		                                                                                                result);
+	default:
+		throw InternalException("Unsupported type for FusedExpression");
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,348 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)), state_width(0) {
+	D_ASSERT(CanStreamAggregates(aggregates));
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		aggregate_objects.emplace_back(&aggr);
+		state_width += aggregate_objects.back().payload_size;
+	}
+}
+
+bool PhysicalStreamingAggregate::CanStreamAggregates(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct()) {
+			// DISTINCT aggregates require a hash table per group
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	//! Every group in a chunk can have its own states, plus the state of the group that is carried over
+	static constexpr const idx_t SLOT_COUNT = STANDARD_VECTOR_SIZE + 1;
+
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op)
+	    : op(op), group_executor(context.client), child_executor(context.client), has_group(false), current_slot(0),
+	      addresses(LogicalType::POINTER), finished_states(LogicalType::POINTER) {
+		auto &allocator = Allocator::Get(context.client);
+		vector<LogicalType> group_types;
+		for (auto &group : op.groups) {
+			group_types.push_back(group->return_type);
+			group_executor.AddExpression(*group);
+		}
+		group_chunk.Initialize(allocator, group_types);
+		current_group.Initialize(allocator, group_types, 1);
+
+		vector<LogicalType> payload_types;
+		for (auto &aggregate : op.aggregates) {
+			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+			for (auto &child : aggr.children) {
+				payload_types.push_back(child->return_type);
+				child_executor.AddExpression(*child);
+			}
+		}
+		if (!payload_types.empty()) {
+			aggregate_input_chunk.Initialize(allocator, payload_types);
+		}
+		filter_set.Initialize(context.client, op.aggregate_objects, op.children[0]->GetTypes());
+
+		state_data = make_unsafe_uniq_array<data_t>(MaxValue<idx_t>(SLOT_COUNT * op.state_width, 1));
+		group_starts = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+		next_row_sel.Initialize(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+			next_row_sel.set_index(i, i + 1);
+		}
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			DestroyStates(&current_slot, 1);
+		}
+	}
+
+	data_ptr_t GetSlot(idx_t slot) {
+		return state_data.get() + slot * op.state_width;
+	}
+
+	void InitializeStates(idx_t slot) {
+		auto state_ptr = GetSlot(slot);
+		for (auto &aggr : op.aggregate_objects) {
+			aggr.function.initialize(state_ptr);
+			state_ptr += aggr.payload_size;
+		}
+	}
+
+	//! Points the finished_states vector to the states of the given slots
+	void SetFinishedStates(const idx_t slots[], idx_t count) {
+		auto state_pointers = FlatVector::GetData<data_ptr_t>(finished_states);
+		for (idx_t i = 0; i < count; i++) {
+			state_pointers[i] = GetSlot(slots[i]);
+		}
+	}
+
+	//! Finalizes the aggregates of the given slots into the result (and destroys the states)
+	void FinalizeStates(const idx_t slots[], idx_t count, DataChunk &result) {
+		SetFinishedStates(slots, count);
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregate_objects.size(); aggr_idx++) {
+			auto &aggr = op.aggregate_objects[aggr_idx];
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+			aggr.function.finalize(finished_states, aggr_input_data, result.data[op.groups.size() + aggr_idx], count,
+			                       0);
+			if (aggr.function.destructor) {
+				aggr.function.destructor(finished_states, aggr_input_data, count);
+			}
+			VectorOperations::AddInPlace(finished_states, aggr.payload_size, count);
+		}
+	}
+
+	void DestroyStates(const idx_t slots[], idx_t count) {
+		SetFinishedStates(slots, count);
+		for (auto &aggr : op.aggregate_objects) {
+			if (aggr.function.destructor) {
+				AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+				aggr.function.destructor(finished_states, aggr_input_data, count);
+			}
+			VectorOperations::AddInPlace(finished_states, aggr.payload_size, count);
+		}
+	}
+
+	//! Marks the rows of the group chunk that start a new group and gathers the first row of every group in the
+	//! chunk, returns the amount of groups in the chunk
+	idx_t FindGroupStarts(idx_t count) {
+		memset(group_starts.get(), 0, count * sizeof(bool));
+		group_starts[0] = true;
+		bool continues_group = has_group;
+		for (idx_t col_idx = 0; col_idx < group_chunk.ColumnCount(); col_idx++) {
+			auto &group_column = group_chunk.data[col_idx];
+			if (continues_group) {
+				// compare the first row with the group that is carried over from the previous chunk
+				continues_group = VectorOperations::DistinctFrom(group_column, current_group.data[col_idx], nullptr, 1,
+				                                                 &distinct_sel, nullptr) == 0;
+			}
+			if (count <= 1) {
+				continue;
+			}
+			// compare every row with the previous row
+			Vector next_rows(group_column, next_row_sel, count - 1);
+			auto distinct_count =
+			    VectorOperations::DistinctFrom(next_rows, group_column, nullptr, count - 1, &distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				group_starts[distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+		if (continues_group) {
+			group_starts[0] = false;
+		}
+
+		idx_t group_count = 1;
+		group_first_sel.set_index(0, 0);
+		for (idx_t i = 1; i < count; i++) {
+			if (group_starts[i]) {
+				group_first_sel.set_index(group_count++, i);
+			}
+		}
+		return group_count;
+	}
+
+	const PhysicalStreamingAggregate &op;
+
+	//! The executor and chunk of the groups
+	ExpressionExecutor group_executor;
+	DataChunk group_chunk;
+	//! The executor and chunk of the aggregate children
+	ExpressionExecutor child_executor;
+	DataChunk aggregate_input_chunk;
+	//! Aggregate filter data set
+	AggregateFilterDataSet filter_set;
+
+	//! The values of the group that is currently being aggregated
+	DataChunk current_group;
+	//! Whether or not there is a current group
+	bool has_group;
+	//! The slot holding the aggregate states of the current group
+	idx_t current_slot;
+	//! The aggregate states, one slot per group
+	unsafe_unique_array<data_t> state_data;
+
+	//! Whether or not a row in the group chunk starts a new group
+	unsafe_unique_array<bool> group_starts;
+	//! The first row of every group in the group chunk
+	SelectionVector group_first_sel {STANDARD_VECTOR_SIZE};
+	//! Selects row i + 1 for every row i
+	SelectionVector next_row_sel;
+	SelectionVector distinct_sel {STANDARD_VECTOR_SIZE};
+	//! The state addresses of every input row
+	Vector addresses;
+	//! The state addresses of the finished groups
+	Vector finished_states;
+	//! The slots of the finished groups
+	idx_t finished_slots[STANDARD_VECTOR_SIZE + 1];
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// figure out where the groups start
+	state.group_chunk.Reset();
+	state.group_executor.Execute(input, state.group_chunk);
+	const bool carry_over = state.has_group;
+	const auto group_count = state.FindGroupStarts(count);
+	const bool continues_group = carry_over && !state.group_starts[0];
+
+	// assign a slot to every group in the chunk: the first group either continues the current group, or the current
+	// group is finished and the groups in the chunk use the slots after it
+	const auto slot_offset = continues_group ? state.current_slot : state.current_slot + 1;
+	auto slot_of_group = [&](idx_t group_idx) {
+		return (slot_offset + group_idx) % StreamingAggregateState::SLOT_COUNT;
+	};
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	idx_t group_idx = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (state.group_starts[i]) {
+			group_idx += i > 0 ? 1 : 0;
+			state.InitializeStates(slot_of_group(group_idx));
+		}
+		addresses[i] = state.GetSlot(slot_of_group(group_idx));
+	}
+	D_ASSERT(group_idx + 1 == group_count);
+
+	// update the aggregate states
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_objects.size(); aggr_idx++) {
+		auto &aggr = aggregate_objects[aggr_idx];
+		auto &payload_chunk = state.aggregate_input_chunk;
+		Vector filtered_addresses(LogicalType::POINTER);
+		Vector *update_addresses = &state.addresses;
+		idx_t update_count = count;
+		if (aggr.filter) {
+			auto &filter_data = state.filter_set.GetFilterData(aggr_idx);
+			update_count = filter_data.ApplyFilter(input);
+			state.child_executor.SetChunk(filter_data.filtered_payload);
+			filtered_addresses.Slice(state.addresses, filter_data.true_sel, update_count);
+			filtered_addresses.Flatten(update_count);
+			update_addresses = &filtered_addresses;
+		} else {
+			state.child_executor.SetChunk(input);
+		}
+		if (aggr.child_count > 0) {
+			payload_chunk.SetCardinality(update_count);
+		}
+		for (idx_t i = 0; i < aggr.child_count; i++) {
+			state.child_executor.ExecuteExpression(payload_idx + i, payload_chunk.data[payload_idx + i]);
+		}
+		if (update_count > 0) {
+			auto start_of_input = aggr.child_count == 0 ? nullptr : &payload_chunk.data[payload_idx];
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+			aggr.function.update(start_of_input, aggr_input_data, aggr.child_count, *update_addresses, update_count);
+		}
+		payload_idx += aggr.child_count;
+		VectorOperations::AddInPlace(state.addresses, aggr.payload_size, count);
+	}
+
+	// emit all groups that are finished: the group carried over from the previous chunk (if it did not continue)
+	// and all groups in this chunk except for the last one
+	idx_t finished_count = 0;
+	if (carry_over && !continues_group) {
+		for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+			VectorOperations::Copy(state.current_group.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+		}
+		state.finished_slots[finished_count++] = state.current_slot;
+	}
+	if (group_count > 1) {
+		for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+			VectorOperations::Copy(state.group_chunk.data[col_idx], chunk.data[col_idx], state.group_first_sel,
+			                       group_count - 1, 0, finished_count);
+		}
+		for (idx_t g = 0; g + 1 < group_count; g++) {
+			state.finished_slots[finished_count++] = slot_of_group(g);
+		}
+	}
+	if (finished_count > 0) {
+		state.FinalizeStates(state.finished_slots, finished_count, chunk);
+	}
+	chunk.SetCardinality(finished_count);
+
+	// the last group in the chunk becomes the current group
+	if (!continues_group || group_count > 1) {
+		SelectionVector last_sel(state.group_first_sel.data() + group_count - 1);
+		state.current_group.Reset();
+		for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+			VectorOperations::Copy(state.group_chunk.data[col_idx], state.current_group.data[col_idx], last_sel, 1, 0,
+			                       0);
+		}
+		state.current_group.SetCardinality(1);
+	}
+	state.current_slot = slot_of_group(group_count - 1);
+	state.has_group = true;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	// emit the last group
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(state.current_group.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+	}
+	state.FinalizeStates(&state.current_slot, 1, chunk);
+	state.has_group = false;
+	chunk.SetCardinality(1);
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -664,6 +664,9 @@ struct WindowExecutor {
 
 	// all aggregate values are the same for each partition
 	unique_ptr<WindowConstantAggregate> constant_aggregate = nullptr;
+
+	// build a merge sort tree for DISTINCT aggregates
+	unique_ptr<WindowDistinctAggregate> distinct_aggregate = nullptr;
 };
 
 bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
@@ -671,6 +674,11 @@ bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
 		return false;
 	}
 
+	//	DISTINCT aggregates are handled by merge sort trees.
+	if (wexpr.distinct) {
+		return false;
+	}
+
 	//	COUNT(*) is already handled efficiently by segment trees.
 	if (wexpr.children.empty()) {
 		return false;
@@ -735,6 +743,9 @@ WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &cont
 	if (IsConstantAggregate(wexpr)) {
 		constant_aggregate =
 		    make_uniq<WindowConstantAggregate>(AggregateObject(wexpr), wexpr.return_type, partition_mask, count);
+	} else if (wexpr.aggregate && wexpr.distinct && !wexpr.children.empty()) {
+		distinct_aggregate =
+		    make_uniq<WindowDistinctAggregate>(AggregateObject(wexpr), wexpr.return_type, filter_mask, context);
 	}
 
 	// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
@@ -795,6 +806,8 @@ void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const i
 		payload_chunk.Verify();
 		if (constant_aggregate) {
 			constant_aggregate->Sink(payload_chunk, filtering, filtered);
+		} else if (distinct_aggregate) {
+			distinct_aggregate->Sink(payload_chunk, filtering, filtered);
 		} else {
 			payload_collection.Append(payload_chunk, true);
 		}
@@ -834,6 +847,8 @@ void WindowExecutor::Finalize(WindowAggregationMode mode) {
 	// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 	if (constant_aggregate) {
 		constant_aggregate->Finalize();
+	} else if (distinct_aggregate) {
+		distinct_aggregate->Finalize();
 	} else if (wexpr.aggregate) {
 		segment_tree = make_uniq<WindowSegmentTree>(AggregateObject(wexpr), wexpr.return_type, &payload_collection,
 		                                            filter_mask, mode);
@@ -876,6 +891,8 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 		case ExpressionType::WINDOW_AGGREGATE: {
 			if (constant_aggregate) {
 				constant_aggregate->Compute(result, output_offset, bounds.window_start, bounds.window_end);
+			} else if (distinct_aggregate) {
+				distinct_aggregate->Compute(result, output_offset, bounds.window_start, bounds.window_end);
 			} else {
 				segment_tree->Compute(result, output_offset, bounds.window_start, bounds.window_end);
 			}
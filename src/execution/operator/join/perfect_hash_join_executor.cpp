@@ -17,7 +17,14 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
+	for (idx_t key_idx = 0; key_idx < perfect_join_statistics.key_strides.size(); key_idx++) {
+		if (perfect_join_statistics.build_min[key_idx].IsNull() ||
+		    perfect_join_statistics.build_max[key_idx].IsNull()) {
+			return false;
+		}
+	}
+
 	// First, allocate memory for each build column
 	auto build_size = perfect_join_statistics.build_range + 1;
 	for (const auto &type : ht.build_types) {
@@ -30,10 +37,10 @@ bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
 
 	// Now fill columns with build data
 
-	return FullScanHashTable(key_type);
+	return FullScanHashTable();
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable() {
 	auto &data_collection = ht.GetDataCollection();
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
@@ -49,19 +56,38 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	}
 
 	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+	vector<Vector> build_keys;
+	for (idx_t col_no = 0; col_no < ht.condition_types.size(); col_no++) {
+		build_keys.emplace_back(ht.condition_types[col_no], key_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_keys.back(), key_count, col_no);
+	}
+
+	// Compute the perfect hash table index of each build tuple
+	auto indexes = make_unsafe_uniq_array<idx_t>(key_count);
+	auto in_domain = make_unsafe_uniq_array<bool>(key_count);
+	FillKeyIndexes(build_keys.data(), key_count, indexes.get(), in_domain.get());
 
 	// Now fill the selection vector using the build keys and create a sequential vector
 	// TODO: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(key_count + 1);
 	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
-
-	// early out
-	if (!success) {
-		return false;
+	idx_t sel_idx = 0;
+	for (idx_t i = 0; i < key_count; ++i) {
+		// add index to selection vector if value in the range
+		if (!in_domain[i]) {
+			continue;
+		}
+		const auto idx = indexes[i];
+		// early out on duplicate keys
+		if (bitmap_build_idx[idx]) {
+			return false;
+		}
+		bitmap_build_idx[idx] = true;
+		unique_keys++;
+		sel_build.set_index(sel_idx, idx);
+		sel_tuples.set_index(sel_idx++, i);
 	}
+
 	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
@@ -84,59 +110,79 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
+//===--------------------------------------------------------------------===//
+// Key Indexes
+//===--------------------------------------------------------------------===//
+void PerfectHashJoinExecutor::FillKeyIndexes(Vector keys[], idx_t count, idx_t indexes[], bool in_domain[]) {
+	std::fill_n(indexes, count, 0);
+	std::fill_n(in_domain, count, true);
+	for (idx_t key_idx = 0; key_idx < perfect_join_statistics.key_strides.size(); key_idx++) {
+		FillKeyIndexesSwitch(keys[key_idx], key_idx, count, indexes, in_domain);
+	}
+}
+
+void PerfectHashJoinExecutor::FillKeyIndexesSwitch(Vector &source, idx_t key_idx, idx_t count, idx_t indexes[],
+                                                   bool in_domain[]) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<int8_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<int16_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<int32_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<int64_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<uint8_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<uint16_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<uint32_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
+		TemplatedFillKeyIndexes<uint64_t>(source, key_idx, count, indexes, in_domain);
+		break;
 	default:
 		throw NotImplementedException("Type not supported for perfect hash join");
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+void PerfectHashJoinExecutor::TemplatedFillKeyIndexes(Vector &source, idx_t key_idx, idx_t count, idx_t indexes[],
+                                                      bool in_domain[]) {
+	auto min_value = perfect_join_statistics.build_min[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.build_max[key_idx].GetValueUnsafe<T>();
+	const auto stride = perfect_join_statistics.key_strides[key_idx];
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
 	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
+	auto &validity_mask = vector_data.validity;
+	for (idx_t i = 0; i < count; ++i) {
+		if (!in_domain[i]) {
+			continue;
+		}
+		// retrieve value from vector
 		auto data_idx = vector_data.sel->get_index(i);
+		if (!validity_mask.RowIsValid(data_idx)) {
+			in_domain[i] = false;
+			continue;
+		}
 		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
-		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+		// only keys in the range can match
+		if (input_value < min_value || max_value < input_value) {
+			in_domain[i] = false;
+			continue;
 		}
+		// subtract min value to get the idx position
+		indexes[i] += (idx_t)(input_value - min_value) * stride;
 	}
-	return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -151,14 +197,16 @@ public:
 		}
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
-		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
-	SelectionVector seq_sel_vec;
+	//! The perfect hash table index of each probe key
+	idx_t key_indexes[STANDARD_VECTOR_SIZE];
+	//! Whether the probe key is in the build domain
+	bool key_in_domain[STANDARD_VECTOR_SIZE];
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -175,11 +223,17 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	// fetch the join keys from the chunk
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
+	// compute the perfect hash table index of the keys that are in the min-max range
 	auto keys_count = state.join_keys.size();
+	FillKeyIndexes(state.join_keys.data.data(), keys_count, state.key_indexes, state.key_in_domain);
 	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	for (idx_t i = 0; i < keys_count; ++i) {
+		// check for matches in the build
+		if (state.key_in_domain[i] && bitmap_build_idx[state.key_indexes[i]]) {
+			state.build_sel_vec.set_index(probe_sel_count, state.key_indexes[i]);
+			state.probe_sel_vec.set_index(probe_sel_count++, i);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -199,87 +253,4 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	}
-}
-
 } // namespace duckdb
@@ -34,6 +34,8 @@ ParallelCSVReader::ParallelCSVReader(ClientContext &context, BufferedCSVReaderOp
 	if (options.delimiter.size() > 1 || options.escape.size() > 1 || options.quote.size() > 1) {
 		throw InternalException("Parallel CSV reader cannot handle CSVs with multi-byte delimiters/escapes/quotes");
 	}
+	unquoted_search = CSVCharacterSearch({options.delimiter[0], options.quote[0], '\n', '\r'});
+	quoted_search = CSVCharacterSearch({options.quote[0], options.escape[0]});
 }
 
 void ParallelCSVReader::Initialize(const vector<LogicalType> &requested_types) {
@@ -340,6 +342,11 @@ normal : {
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip ahead to the next character that can end the value
+		position_buffer = buffer->Find(unquoted_search, position_buffer, end_buffer);
+		if (position_buffer == end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.delimiter[0]) {
 			// delimiter: end the value and add it to the chunk
@@ -466,6 +473,11 @@ in_quotes:
 	has_quotes = true;
 	position_buffer++;
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip ahead to the next quote or escape
+		position_buffer = buffer->Find(quoted_search, position_buffer, end_buffer);
+		if (position_buffer == end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.quote[0]) {
 			// quote: move to unquoted state
@@ -24,12 +24,49 @@ public:
 	bool initialized;
 };
 
+class PhysicalColumnDataParallelScanState : public GlobalSourceState {
+public:
+	explicit PhysicalColumnDataParallelScanState(const ColumnDataCollection &collection) : collection(collection) {
+		collection.InitializeScan(scan_state);
+	}
+
+	const ColumnDataCollection &collection;
+	ColumnDataParallelScanState scan_state;
+
+	idx_t MaxThreads() override {
+		// the collection is only scanned after it has been materialized
+		return collection.ChunkCount();
+	}
+};
+
+class PhysicalColumnDataLocalScanState : public LocalSourceState {
+public:
+	ColumnDataLocalScanState scan_state;
+};
+
 unique_ptr<GlobalSourceState> PhysicalColumnDataScan::GetGlobalSourceState(ClientContext &context) const {
+	if (ParallelSource()) {
+		return make_uniq<PhysicalColumnDataParallelScanState>(*collection);
+	}
 	return make_uniq<PhysicalColumnDataScanState>();
 }
 
+unique_ptr<LocalSourceState> PhysicalColumnDataScan::GetLocalSourceState(ExecutionContext &context,
+                                                                         GlobalSourceState &gstate) const {
+	if (ParallelSource()) {
+		return make_uniq<PhysicalColumnDataLocalScanState>();
+	}
+	return PhysicalOperator::GetLocalSourceState(context, gstate);
+}
+
 SourceResultType PhysicalColumnDataScan::GetData(ExecutionContext &context, DataChunk &chunk,
                                                  OperatorSourceInput &input) const {
+	if (ParallelSource()) {
+		auto &gstate = input.global_state.Cast<PhysicalColumnDataParallelScanState>();
+		auto &lstate = input.local_state.Cast<PhysicalColumnDataLocalScanState>();
+		collection->Scan(gstate.scan_state, lstate.scan_state, chunk);
+		return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+	}
 	auto &state = input.global_state.Cast<PhysicalColumnDataScanState>();
 	if (collection->Count() == 0) {
 		return SourceResultType::FINISHED;
@@ -43,6 +80,13 @@ SourceResultType PhysicalColumnDataScan::GetData(ExecutionContext &context, Data
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
 
+idx_t PhysicalColumnDataScan::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
+                                            LocalSourceState &lstate_p) const {
+	D_ASSERT(SupportsBatchIndex());
+	auto &lstate = lstate_p.Cast<PhysicalColumnDataLocalScanState>();
+	return lstate.scan_state.current_row_index;
+}
+
 //===--------------------------------------------------------------------===//
 // Pipeline Construction
 //===--------------------------------------------------------------------===//
@@ -64,6 +108,16 @@ void PhysicalColumnDataScan::BuildPipelines(Pipeline &current, MetaPipeline &met
 		state.SetPipelineSource(current, delim_join.distinct->Cast<PhysicalOperator>());
 		return;
 	}
+	case PhysicalOperatorType::CTE_SCAN: {
+		auto entry = state.cte_dependencies.find(*this);
+		D_ASSERT(entry != state.cte_dependencies.end());
+		// this chunk scan introduces a dependency to the current pipeline
+		// namely a dependency on the CTE pipeline to finish
+		auto cte_dependency = entry->second.get().shared_from_this();
+		current.AddDependency(cte_dependency);
+		state.SetPipelineSource(current, *this);
+		return;
+	}
 	case PhysicalOperatorType::RECURSIVE_CTE_SCAN:
 		if (!meta_pipeline.HasRecursiveCTE()) {
 			throw InternalException("Recursive CTE scan found without recursive CTE node");
@@ -0,0 +1,95 @@
+#include "duckdb/execution/operator/set/physical_cte.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+
+namespace duckdb {
+
+PhysicalCTE::PhysicalCTE(string ctename, idx_t table_index, vector<LogicalType> types, unique_ptr<PhysicalOperator> top,
+                         unique_ptr<PhysicalOperator> bottom, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CTE, std::move(types), estimated_cardinality), table_index(table_index),
+      ctename(std::move(ctename)) {
+	children.push_back(std::move(top));
+	children.push_back(std::move(bottom));
+}
+
+PhysicalCTE::~PhysicalCTE() {
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class CTEGlobalState : public GlobalSinkState {
+public:
+	explicit CTEGlobalState(ColumnDataCollection &working_table) : working_table(working_table) {
+	}
+
+	mutex lock;
+	ColumnDataCollection &working_table;
+};
+
+class CTELocalState : public LocalSinkState {
+public:
+	CTELocalState(ClientContext &context, const PhysicalCTE &op)
+	    : collection(context, op.children[0]->GetTypes()) {
+		collection.InitializeAppend(append_state);
+	}
+
+	ColumnDataCollection collection;
+	ColumnDataAppendState append_state;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCTE::GetGlobalSinkState(ClientContext &context) const {
+	working_table->Reset();
+	return make_uniq<CTEGlobalState>(*working_table);
+}
+
+unique_ptr<LocalSinkState> PhysicalCTE::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<CTELocalState>(context.client, *this);
+}
+
+SinkResultType PhysicalCTE::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<CTELocalState>();
+	lstate.collection.Append(lstate.append_state, chunk);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalCTE::Combine(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p) const {
+	auto &gstate = gstate_p.Cast<CTEGlobalState>();
+	auto &lstate = lstate_p.Cast<CTELocalState>();
+
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.working_table.Combine(lstate.collection);
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalCTE::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	op_state.reset();
+	sink_state.reset();
+
+	// the CTE is materialized in a child pipeline
+	auto &child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, *this);
+	child_meta_pipeline.Build(*children[0]);
+
+	// any scan of the materialized CTE depends on this pipeline
+	// we add an entry to the mapping of (PhysicalOperator*) -> (Pipeline*)
+	auto &state = meta_pipeline.GetState();
+	for (auto &cte_scan : cte_scans) {
+		state.cte_dependencies.insert(make_pair(cte_scan, reference<Pipeline>(*child_meta_pipeline.GetBasePipeline())));
+	}
+	// the remainder of the query produces the result of this operator
+	children[1]->BuildPipelines(current, meta_pipeline);
+}
+
+vector<const_reference<PhysicalOperator>> PhysicalCTE::GetSources() const {
+	return children[1]->GetSources();
+}
+
+string PhysicalCTE::ParamsToString() const {
+	return ctename;
+}
+
+} // namespace duckdb
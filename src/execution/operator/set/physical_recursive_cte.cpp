@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 
+#include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
@@ -26,54 +27,149 @@ PhysicalRecursiveCTE::~PhysicalRecursiveCTE() {
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+//! A partition of the hash table that is used to eliminate duplicate rows for UNION
+struct RecursiveCTEPartition {
+	RecursiveCTEPartition(ClientContext &context, const vector<LogicalType> &types)
+	    : ht(context, Allocator::Get(context), types, vector<LogicalType>(), vector<BoundAggregateExpression *>()) {
+	}
+
+	mutex lock;
+	GroupedAggregateHashTable ht;
+	AggregateHTAppendState append_state;
+};
+
 class RecursiveCTEState : public GlobalSinkState {
 public:
 	explicit RecursiveCTEState(ClientContext &context, const PhysicalRecursiveCTE &op)
-	    : intermediate_table(context, op.GetTypes()), new_groups(STANDARD_VECTOR_SIZE) {
-		ht = make_uniq<GroupedAggregateHashTable>(context, Allocator::Get(context), op.types, vector<LogicalType>(),
-		                                          vector<BoundAggregateExpression *>());
+	    : intermediate_table(context, op.GetTypes()) {
+		if (!op.union_all) {
+			// partition the hash table on the hash of the rows, so threads can eliminate duplicates concurrently
+			auto partition_count = MinValue<idx_t>(
+			    NextPowerOfTwo(TaskScheduler::GetScheduler(context).NumberOfThreads()), MAX_PARTITION_COUNT);
+			radix_bits = RadixPartitioning::RadixBits(partition_count);
+			for (idx_t i = 0; i < partition_count; i++) {
+				partitions.push_back(make_uniq<RecursiveCTEPartition>(context, op.types));
+			}
+		}
 	}
 
-	unique_ptr<GroupedAggregateHashTable> ht;
+	//! The maximum amount of hash table partitions
+	static constexpr const idx_t MAX_PARTITION_COUNT = 64;
 
-	bool intermediate_empty = true;
+	//! The partitioned hash table used to eliminate duplicates (UNION only)
+	vector<unique_ptr<RecursiveCTEPartition>> partitions;
+	idx_t radix_bits = 0;
+
+	//! Lock for combining the thread-local results into the intermediate table
+	mutex intermediate_table_lock;
 	ColumnDataCollection intermediate_table;
 	ColumnDataScanState scan_state;
 	bool initialized = false;
 	bool finished_scan = false;
+};
+
+class RecursiveCTELocalState : public LocalSinkState {
+public:
+	RecursiveCTELocalState(ClientContext &context, const PhysicalRecursiveCTE &op)
+	    : local_table(context, op.GetTypes()), hashes(LogicalType::HASH), addresses(LogicalType::POINTER),
+	      new_groups(STANDARD_VECTOR_SIZE) {
+		local_table.InitializeAppend(append_state);
+		partition_chunk.InitializeEmpty(op.GetTypes());
+		auto &gstate = op.sink_state->Cast<RecursiveCTEState>();
+		for (idx_t i = 0; i < gstate.partitions.size(); i++) {
+			partition_sel.emplace_back(STANDARD_VECTOR_SIZE);
+		}
+		partition_counts.resize(gstate.partitions.size());
+	}
+
+	//! The rows produced by this thread in the current iteration
+	ColumnDataCollection local_table;
+	ColumnDataAppendState append_state;
+
+	Vector hashes;
+	Vector addresses;
 	SelectionVector new_groups;
-	AggregateHTAppendState append_state;
+	DataChunk partition_chunk;
+	vector<SelectionVector> partition_sel;
+	vector<idx_t> partition_counts;
 };
 
 unique_ptr<GlobalSinkState> PhysicalRecursiveCTE::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<RecursiveCTEState>(context, *this);
 }
 
-idx_t PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const {
-	Vector dummy_addresses(LogicalType::POINTER);
+unique_ptr<LocalSinkState> PhysicalRecursiveCTE::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<RecursiveCTELocalState>(context.client, *this);
+}
 
-	// Use the HT to eliminate duplicate rows
-	idx_t new_group_count = state.ht->FindOrCreateGroups(state.append_state, chunk, dummy_addresses, state.new_groups);
+idx_t PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, Vector &hashes, RecursiveCTEPartition &partition,
+                                    RecursiveCTELocalState &lstate) const {
+	idx_t new_group_count;
+	{
+		// Use the HT to eliminate duplicate rows
+		lock_guard<mutex> guard(partition.lock);
+		new_group_count =
+		    partition.ht.FindOrCreateGroups(partition.append_state, chunk, hashes, lstate.addresses, lstate.new_groups);
+	}
 
 	// we only return entries we have not seen before (i.e. new groups)
-	chunk.Slice(state.new_groups, new_group_count);
+	chunk.Slice(lstate.new_groups, new_group_count);
 
 	return new_group_count;
 }
 
 SinkResultType PhysicalRecursiveCTE::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<RecursiveCTEState>();
-	if (!union_all) {
-		idx_t match_count = ProbeHT(chunk, gstate);
-		if (match_count > 0) {
-			gstate.intermediate_table.Append(chunk);
+	auto &lstate = input.local_state.Cast<RecursiveCTELocalState>();
+	if (union_all) {
+		lstate.local_table.Append(lstate.append_state, chunk);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
+	chunk.Hash(lstate.hashes);
+	if (gstate.partitions.size() == 1) {
+		if (ProbeHT(chunk, lstate.hashes, *gstate.partitions[0], lstate) > 0) {
+			lstate.local_table.Append(lstate.append_state, chunk);
+		}
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
+	// divide the rows over the partitions of the hash table
+	lstate.hashes.Flatten(chunk.size());
+	auto hash_data = FlatVector::GetData<hash_t>(lstate.hashes);
+	auto mask = RadixPartitioning::Mask(gstate.radix_bits);
+	auto shift = RadixPartitioning::Shift(gstate.radix_bits);
+	std::fill(lstate.partition_counts.begin(), lstate.partition_counts.end(), 0);
+	for (idx_t i = 0; i < chunk.size(); i++) {
+		auto partition_idx = (hash_data[i] & mask) >> shift;
+		lstate.partition_sel[partition_idx].set_index(lstate.partition_counts[partition_idx]++, i);
+	}
+	for (idx_t partition_idx = 0; partition_idx < gstate.partitions.size(); partition_idx++) {
+		auto count = lstate.partition_counts[partition_idx];
+		if (count == 0) {
+			continue;
+		}
+		auto &sel = lstate.partition_sel[partition_idx];
+		lstate.partition_chunk.Slice(chunk, sel, count);
+		Vector partition_hashes(lstate.hashes, sel, count);
+		if (ProbeHT(lstate.partition_chunk, partition_hashes, *gstate.partitions[partition_idx], lstate) > 0) {
+			lstate.local_table.Append(lstate.append_state, lstate.partition_chunk);
 		}
-	} else {
-		gstate.intermediate_table.Append(chunk);
 	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalRecursiveCTE::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                   LocalSinkState &lstate_p) const {
+	auto &gstate = gstate_p.Cast<RecursiveCTEState>();
+	auto &lstate = lstate_p.Cast<RecursiveCTELocalState>();
+	if (lstate.local_table.Count() == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(gstate.intermediate_table_lock);
+	gstate.intermediate_table.Combine(lstate.local_table);
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -58,17 +58,45 @@ bool ExtractNumericValue(Value val, int64_t &result) {
 	return true;
 }
 
+//! Extract the [min, max] domain of a join key, either from the statistics or from the dictionary of an ENUM
+static bool ExtractKeyDomain(const Expression &key, BaseStatistics &stats, Value &min, Value &max, int64_t &min_value,
+                             int64_t &max_value) {
+	auto &type = key.return_type;
+	if (type.id() == LogicalTypeId::ENUM) {
+		// ENUM keys are dense dictionary indexes
+		const auto dict_size = EnumType::GetSize(type);
+		if (dict_size == 0) {
+			return false;
+		}
+		min = Value::ENUM(0, type);
+		max = Value::ENUM(dict_size - 1, type);
+		min_value = 0;
+		max_value = int64_t(dict_size - 1);
+		return true;
+	}
+	if (!TypeIsInteger(type.InternalType()) || type.InternalType() == PhysicalType::INT128) {
+		// perfect join not possible for non-integral types or hugeint
+		return false;
+	}
+	if (!NumericStats::HasMinMax(stats)) {
+		return false;
+	}
+	if (!ExtractNumericValue(NumericStats::Min(stats), min_value) ||
+	    !ExtractNumericValue(NumericStats::Max(stats), max_value)) {
+		return false;
+	}
+	min = NumericStats::Min(stats);
+	max = NumericStats::Max(stats);
+	return true;
+}
+
 void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &join_state) {
 	// we only do this optimization for inner joins
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.empty() || op.join_stats.size() != 2 * op.conditions.size()) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -85,52 +113,56 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		if (condition.comparison != ExpressionType::COMPARE_EQUAL) {
 			return;
 		}
-	}
-	// with integral internal types
-	for (auto &&join_stat : op.join_stats) {
-		if (!TypeIsInteger(join_stat->GetType().InternalType()) ||
-		    join_stat->GetType().InternalType() == PhysicalType::INT128) {
-			// perfect join not possible for non-integral types or hugeint
+		if (condition.left->return_type != condition.right->return_type) {
 			return;
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto &stats_build = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_build)) {
-		return;
-	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
-	    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
-		return;
-	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
-	}
-
-	// Fill join_stats for invisible join
-	auto &stats_probe = *op.join_stats[1].get(); // rhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
-	}
-
 	// The max size our build must have to run the perfect HJ
 	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
-	join_state.build_min = NumericStats::Min(stats_build);
-	join_state.build_max = NumericStats::Max(stats_build);
-	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = build_range;
-	if (join_state.build_range > MAX_BUILD_SIZE) {
-		return;
-	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
-	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
-		join_state.is_probe_in_domain = true;
+
+	// Composite keys are laid out in row-major order: the slot is the sum of (key - min) * stride
+	idx_t build_size = 1;
+	bool is_probe_in_domain = true;
+	for (idx_t i = 0; i < op.conditions.size(); i++) {
+		auto &condition = op.conditions[i];
+		auto &stats_build = *op.join_stats[2 * i].get();     // lhs stats
+		auto &stats_probe = *op.join_stats[2 * i + 1].get(); // rhs stats
+
+		// and when the build range is smaller than the threshold
+		Value build_min, build_max;
+		int64_t build_min_value, build_max_value;
+		if (!ExtractKeyDomain(*condition.left, stats_build, build_min, build_max, build_min_value, build_max_value)) {
+			return;
+		}
+		int64_t build_range;
+		if (!TrySubtractOperator::Operation(build_max_value, build_min_value, build_range)) {
+			return;
+		}
+		if (idx_t(build_range) + 1 > (MAX_BUILD_SIZE + 1) / build_size) {
+			return;
+		}
+
+		// Fill join_stats for invisible join
+		Value probe_min, probe_max;
+		int64_t probe_min_value, probe_max_value;
+		if (!ExtractKeyDomain(*condition.right, stats_probe, probe_min, probe_max, probe_min_value, probe_max_value)) {
+			return;
+		}
+		if (probe_min_value < build_min_value || build_max_value < probe_max_value) {
+			is_probe_in_domain = false;
+		}
+
+		join_state.build_min.push_back(std::move(build_min));
+		join_state.build_max.push_back(std::move(build_max));
+		join_state.probe_min.push_back(std::move(probe_min));
+		join_state.probe_max.push_back(std::move(probe_max));
+		join_state.key_strides.push_back(build_size);
+		build_size *= idx_t(build_range) + 1;
 	}
+	join_state.estimated_cardinality = op.estimated_cardinality;
+	join_state.build_range = build_size - 1;
+	join_state.is_probe_in_domain = is_probe_in_domain;
 	join_state.is_build_small = true;
 	return;
 }
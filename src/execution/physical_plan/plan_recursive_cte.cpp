@@ -1,9 +1,11 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/execution/operator/set/physical_cte.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_cteref.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
 #include "duckdb/planner/operator/logical_recursive_cte.hpp"
 
 namespace duckdb {
@@ -27,18 +29,47 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalRecursiveC
 	return std::move(cte);
 }
 
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalMaterializedCTE &op) {
+	D_ASSERT(op.children.size() == 2);
+
+	// Create the working_table that the PhysicalCTE will materialize the CTE into.
+	auto working_table = std::make_shared<ColumnDataCollection>(context, op.children[0]->types);
+
+	// Add the ColumnDataCollection to the context of this PhysicalPlanGenerator
+	recursive_cte_tables[op.table_index] = working_table;
+	materialized_ctes[op.table_index] = vector<const_reference<PhysicalOperator>>();
+
+	auto left = CreatePlan(*op.children[0]);
+	auto right = CreatePlan(*op.children[1]);
+
+	auto cte = make_uniq<PhysicalCTE>(op.ctename, op.table_index, op.children[1]->types, std::move(left),
+	                                  std::move(right), op.estimated_cardinality);
+	cte->working_table = working_table;
+	cte->cte_scans = materialized_ctes[op.table_index];
+	cte->parallel = !PreserveInsertionOrder(*cte->children[0]);
+
+	return std::move(cte);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCTERef &op) {
 	D_ASSERT(op.children.empty());
 
-	auto chunk_scan =
-	    make_uniq<PhysicalColumnDataScan>(op.types, PhysicalOperatorType::RECURSIVE_CTE_SCAN, op.estimated_cardinality);
+	// references to a materialized CTE scan the materialized result, other references scan the working table of a
+	// recursive CTE
+	auto materialized_cte = materialized_ctes.find(op.cte_index);
+	auto scan_type = materialized_cte != materialized_ctes.end() ? PhysicalOperatorType::CTE_SCAN
+	                                                             : PhysicalOperatorType::RECURSIVE_CTE_SCAN;
+	auto chunk_scan = make_uniq<PhysicalColumnDataScan>(op.types, scan_type, op.estimated_cardinality);
 
-	// CreatePlan of a LogicalRecursiveCTE must have happened before.
+	// CreatePlan of a LogicalRecursiveCTE or LogicalMaterializedCTE must have happened before.
 	auto cte = recursive_cte_tables.find(op.cte_index);
 	if (cte == recursive_cte_tables.end()) {
 		throw InvalidInputException("Referenced recursive CTE does not exist.");
 	}
 	chunk_scan->collection = cte->second.get();
+	if (materialized_cte != materialized_ctes.end()) {
+		materialized_cte->second.push_back(*chunk_scan);
+	}
 	return std::move(chunk_scan);
 }
 
@@ -20,7 +20,7 @@ static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
 	case ExpressionType::WINDOW_AGGREGATE:
 		// We can stream aggregates if they are "running totals" and don't use filters
 		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS &&
-		       !wexpr.filter_expr;
+		       !wexpr.filter_expr && !wexpr.distinct;
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -6,6 +6,8 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+#include "duckdb/optimizer/order_properties.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/operator/logical_extension_operator.hpp"
 #include "duckdb/planner/operator/list.hpp"
@@ -39,6 +41,9 @@ PhysicalPlanGenerator::~PhysicalPlanGenerator() {
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(unique_ptr<LogicalOperator> op) {
 	auto &profiler = QueryProfiler::Get(context);
 
+	// the order of the input of an aggregate is derived from the column bindings, so check it before resolving them
+	OrderProperties::MarkStreamingAggregates(*op);
+
 	// first resolve column references
 	profiler.StartPhase("column_binding");
 	ColumnBindingResolver resolver;
@@ -67,6 +72,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOperator &
 	op.estimated_cardinality = op.EstimateCardinality(context);
 	unique_ptr<PhysicalOperator> plan = nullptr;
 
+	// the operator is consumed by the plan generation, so we compute its feedback key first
+	string feedback_key;
+	idx_t feedback_base_cardinality = 0;
+	if (CardinalityFeedback::IsEnabled(context)) {
+		feedback_key = CardinalityFeedback::GetRelationKey(context, op, feedback_base_cardinality);
+	}
+
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_GET:
 		plan = CreatePlan(op.Cast<LogicalGet>());
@@ -194,6 +206,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOperator &
 	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE:
 		plan = CreatePlan(op.Cast<LogicalRecursiveCTE>());
 		break;
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE:
+		plan = CreatePlan(op.Cast<LogicalMaterializedCTE>());
+		break;
 	case LogicalOperatorType::LOGICAL_CTE_REF:
 		plan = CreatePlan(op.Cast<LogicalCTERef>());
 		break;
@@ -231,6 +246,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOperator &
 	} else {
 		plan->estimated_props = make_uniq<EstimatedProperties>();
 	}
+	if (!feedback_key.empty()) {
+		plan->feedback_key = std::move(feedback_key);
+		plan->feedback_base_cardinality = feedback_base_cardinality;
+	}
 
 	return plan;
 }
@@ -3,6 +3,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
 
 namespace duckdb {
 
@@ -178,6 +179,220 @@ void WindowConstantAggregate::Compute(Vector &target, idx_t rid, idx_t start, id
 	VectorOperations::Copy(*results, target, partition + 1, partition, rid);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowDistinctAggregate
+//===--------------------------------------------------------------------===//
+WindowDistinctAggregate::WindowDistinctAggregate(AggregateObject aggr, const LogicalType &result_type,
+                                                 const ValidityMask &filter_mask, ClientContext &context)
+    : WindowAggregateState(std::move(aggr), result_type), context(context), filter_mask(filter_mask),
+      count_only(this->aggr.function.name == "count" && this->aggr.child_count == 1),
+      distinct_sel(STANDARD_VECTOR_SIZE), statel(LogicalType::POINTER) {
+	//	Holistic aggregates (e.g. mode and quantiles) have states that grow with their input,
+	//	and order-sensitive aggregates cannot combine states out of row order, so they aggregate the rows one by one
+	const auto &function = this->aggr.function;
+	use_prefix_states = !count_only && function.combine && !function.window &&
+	                    function.order_dependent == AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	statep.Flatten(STANDARD_VECTOR_SIZE);
+}
+
+WindowDistinctAggregate::~WindowDistinctAggregate() {
+	if (!aggr.function.destructor) {
+		return;
+	}
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	for (idx_t begin = 0; begin < internal_nodes; begin += STANDARD_VECTOR_SIZE) {
+		const auto batch = MinValue<idx_t>(internal_nodes - begin, STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < batch; ++i) {
+			ldata[i] = levels_flat_native.get() + (begin + i) * state.size();
+		}
+		aggr.function.destructor(statel, aggr_input_data, batch);
+	}
+}
+
+void WindowDistinctAggregate::Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) {
+	//	Filtered rows are removed from the index in Finalize
+	if (!inputs.ColumnCount() && payload_chunk.ColumnCount()) {
+		inputs.Initialize(Allocator::DefaultAllocator(), payload_chunk.GetTypes());
+	}
+	inputs.Append(payload_chunk, true);
+}
+
+void WindowDistinctAggregate::Finalize() {
+	const auto count = inputs.size();
+	const auto types = inputs.GetTypes();
+
+	//	Find the group of distinct arguments for each included row.
+	//	COUNT ignores NULLs, so we can drop them here and just count the index entries.
+	GroupedAggregateHashTable ht(context, Allocator::Get(context), types);
+	AggregateHTAppendState append_state;
+	Vector addresses(LogicalType::POINTER);
+	auto group_addresses = FlatVector::GetData<data_ptr_t>(addresses);
+
+	DataChunk groups;
+	groups.InitializeEmpty(types);
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	vector<std::pair<data_ptr_t, idx_t>> group_rows;
+	group_rows.reserve(count);
+	for (idx_t begin = 0; begin < count; begin += STANDARD_VECTOR_SIZE) {
+		const auto end = MinValue<idx_t>(begin + STANDARD_VECTOR_SIZE, count);
+		idx_t included = 0;
+		for (auto i = begin; i < end; ++i) {
+			if (!filter_mask.RowIsValid(i)) {
+				continue;
+			}
+			if (count_only && !FlatVector::Validity(inputs.data[0]).RowIsValid(i)) {
+				continue;
+			}
+			sel.set_index(included++, i - begin);
+		}
+		if (!included) {
+			continue;
+		}
+
+		for (idx_t c = 0; c < groups.ColumnCount(); ++c) {
+			groups.data[c].Slice(inputs.data[c], begin, end);
+		}
+		groups.SetCardinality(end - begin);
+		if (included != groups.size()) {
+			groups.Slice(sel, included);
+		}
+
+		ht.FindOrCreateGroups(append_state, groups, addresses);
+		for (idx_t i = 0; i < included; ++i) {
+			group_rows.emplace_back(group_addresses[i], begin + sel.get_index(i));
+		}
+	}
+
+	//	Link each row to the previous row in its group.
+	//	A row is the first occurrence of its group in a frame iff its predecessor is before the frame.
+	//	Excluded rows have no valid predecessor and are never counted.
+	std::sort(group_rows.begin(), group_rows.end());
+	DistinctTree::Elements prevs;
+	prevs.reserve(count);
+	for (idx_t i = 0; i < count; ++i) {
+		prevs.emplace_back(NumericLimits<idx_t>::Maximum(), i);
+	}
+	for (idx_t i = 0; i < group_rows.size(); ++i) {
+		const auto row = group_rows[i].second;
+		const auto same_group = (i > 0 && group_rows[i - 1].first == group_rows[i].first);
+		prevs[row].first = same_group ? group_rows[i - 1].second + 1 : 0;
+	}
+
+	distinct_tree = make_uniq<DistinctTree>(std::move(prevs));
+
+	frame.InitializeEmpty(types);
+	if (use_prefix_states) {
+		ConstructStates();
+	}
+}
+
+void WindowDistinctAggregate::ConstructStates() {
+	const auto count = distinct_tree->size();
+	const auto state_size = state.size();
+	const auto &tree = distinct_tree->tree;
+	internal_nodes = (tree.size() - 1) * count;
+	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	Vector targets(LogicalType::POINTER);
+	auto tdata = FlatVector::GetData<data_ptr_t>(targets);
+	idx_t run_length = 1;
+	for (idx_t level_no = 1; level_no < tree.size(); ++level_no) {
+		run_length *= DistinctTree::FANOUT;
+		const auto &level = tree[level_no];
+		const auto level_states = levels_flat_native.get() + (level_no - 1) * count * state_size;
+
+		//	Start the state of each element with the row of that element
+		for (idx_t begin = 0; begin < count; begin += STANDARD_VECTOR_SIZE) {
+			const auto batch = MinValue<idx_t>(count - begin, STANDARD_VECTOR_SIZE);
+			for (idx_t i = 0; i < batch; ++i) {
+				ldata[i] = level_states + (begin + i) * state_size;
+				aggr.function.initialize(ldata[i]);
+				distinct_sel.set_index(i, level[begin + i].second);
+			}
+			frame.Slice(inputs, distinct_sel, batch);
+			aggr.function.update(frame.data.data(), aggr_input_data, frame.ColumnCount(), statel, batch);
+		}
+
+		//	Accumulate the states along each run.
+		//	The elements at the same offset in different runs are independent, so we combine them in batches.
+		for (idx_t offset = 1; offset < run_length; ++offset) {
+			for (idx_t run_begin = 0; run_begin + offset < count;) {
+				idx_t batch = 0;
+				for (; batch < STANDARD_VECTOR_SIZE && run_begin + offset < count; ++batch, run_begin += run_length) {
+					tdata[batch] = level_states + (run_begin + offset) * state_size;
+					ldata[batch] = tdata[batch] - state_size;
+				}
+				aggr.function.combine(statel, targets, aggr_input_data, batch);
+			}
+		}
+	}
+}
+
+void WindowDistinctAggregate::UpdateRows() {
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+	for (idx_t begin = 0; begin < distinct_rows.size(); begin += STANDARD_VECTOR_SIZE) {
+		const auto batch = MinValue<idx_t>(distinct_rows.size() - begin, STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < batch; ++i) {
+			distinct_sel.set_index(i, distinct_rows[begin + i]);
+		}
+		frame.Slice(inputs, distinct_sel, batch);
+		aggr.function.update(frame.data.data(), aggr_input_data, frame.ColumnCount(), statep, batch);
+	}
+}
+
+void WindowDistinctAggregate::CombineStates() {
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	for (idx_t begin = 0; begin < prefix_states.size(); begin += STANDARD_VECTOR_SIZE) {
+		const auto batch = MinValue<idx_t>(prefix_states.size() - begin, STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < batch; ++i) {
+			ldata[i] = prefix_states[begin + i];
+		}
+		aggr.function.combine(statel, statep, aggr_input_data, batch);
+	}
+}
+
+void WindowDistinctAggregate::Compute(Vector &result, idx_t rid, idx_t start, idx_t end) {
+	D_ASSERT(distinct_tree);
+
+	//	The rows in [start, end) whose predecessor is before start
+	const PrevRow needle(start + 1, 0);
+	if (count_only) {
+		auto rdata = FlatVector::GetData<int64_t>(result);
+		rdata[rid] = distinct_tree->CountLowerBound(start, end, needle);
+		return;
+	}
+
+	//	Collect the first occurrences.
+	//	With prefix states, a run of a level above the lowest level is covered by the state of its last element,
+	//	so we only combine O(FANOUT * log(n)) states instead of aggregating every first occurrence.
+	distinct_rows.clear();
+	prefix_states.clear();
+	const auto count = distinct_tree->size();
+	distinct_tree->AggregateLowerBound(start, end, needle, [&](idx_t level, idx_t run_begin, idx_t run_end) {
+		if (use_prefix_states && level > 0) {
+			prefix_states.emplace_back(levels_flat_native.get() + ((level - 1) * count + run_end - 1) * state.size());
+			return;
+		}
+		const auto &run = distinct_tree->tree[level];
+		for (auto i = run_begin; i < run_end; ++i) {
+			distinct_rows.emplace_back(run[i].second);
+		}
+	});
+	//	Only order-sensitive aggregates need them in row order
+	if (aggr.function.order_dependent != AggregateOrderDependent::NOT_ORDER_DEPENDENT) {
+		std::sort(distinct_rows.begin(), distinct_rows.end());
+	}
+
+	AggregateInit();
+	UpdateRows();
+	CombineStates();
+	AggegateFinal(result, rid);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
@@ -197,6 +412,11 @@ WindowSegmentTree::WindowSegmentTree(AggregateObject aggr_p, const LogicalType &
 		if (aggr.function.window && UseWindowAPI()) {
 			AggregateInit();
 			inputs.Reference(*input_ref);
+			if (aggr.function.window_init) {
+				AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+				aggr.function.window_init(inputs.data.data(), filter_mask, aggr_input_data, inputs.ColumnCount(),
+				                          state.data(), input_ref->size());
+			}
 		} else {
 			inputs.SetCapacity(*input_ref);
 			if (aggr.function.combine && UseCombineAPI()) {
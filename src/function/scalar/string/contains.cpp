@@ -1,7 +1,9 @@
 #include "duckdb/function/scalar/string_functions.hpp"
 
+#include "duckdb/common/aho_corasick.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -160,6 +162,57 @@ ScalarFunction ContainsFun::GetFunction() {
 
 void ContainsFun::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(GetFunction());
+	set.AddFunction(ContainsAnyFun::GetFunction());
+}
+
+struct ContainsAnyBindData : public FunctionData {
+	explicit ContainsAnyBindData(vector<string> patterns_p) : patterns(std::move(patterns_p)), matcher(patterns) {
+	}
+
+	vector<string> patterns;
+	AhoCorasick matcher;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ContainsAnyBindData>(patterns);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<ContainsAnyBindData>();
+		return patterns == other.patterns;
+	}
+};
+
+static void ContainsAnyFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<ContainsAnyBindData>();
+	UnaryExecutor::Execute<string_t, bool>(args.data[0], result, args.size(), [&](string_t input) {
+		return info.matcher.ContainsAny(input.GetData(), input.GetSize());
+	});
+}
+
+static unique_ptr<FunctionData> ContainsAnyBind(ClientContext &context, ScalarFunction &bound_function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[1]->IsFoldable()) {
+		throw BinderException("contains_any requires a constant list of patterns");
+	}
+	auto patterns_value = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+	if (patterns_value.IsNull() || ListValue::GetChildren(patterns_value).empty()) {
+		throw BinderException("contains_any requires a non-empty list of patterns");
+	}
+	vector<string> patterns;
+	for (auto &pattern : ListValue::GetChildren(patterns_value)) {
+		if (pattern.IsNull()) {
+			throw BinderException("contains_any patterns cannot be NULL");
+		}
+		patterns.push_back(StringValue::Get(pattern));
+	}
+	return make_uniq<ContainsAnyBindData>(std::move(patterns));
+}
+
+ScalarFunction ContainsAnyFun::GetFunction() {
+	return ScalarFunction("contains_any", {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)},
+	                      LogicalType::BOOLEAN, ContainsAnyFunction, ContainsAnyBind);
 }
 
 } // namespace duckdb
@@ -115,6 +115,9 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
 		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+			if (!lstate.MayMatch(input)) {
+				return false;
+			}
 			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
 		});
 	} else {
@@ -227,6 +230,10 @@ static void RegexExtractFunction(DataChunk &args, ExpressionState &state, Vector
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
 		UnaryExecutor::Execute<string_t, string_t>(strings, result, args.size(), [&](string_t input) {
+			if (!lstate.MayMatch(input)) {
+				// no match: the result is the empty string
+				return string_t(nullptr, 0);
+			}
 			return Extract(input, result, lstate.constant_pattern, info.rewrite);
 		});
 	} else {
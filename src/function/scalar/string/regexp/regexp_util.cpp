@@ -1,5 +1,7 @@
 #include "duckdb/function/scalar/regexp.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar/string_functions.hpp"
+#include "re2/prefilter.h"
 
 namespace duckdb {
 
@@ -76,4 +78,140 @@ void ParseRegexOptions(ClientContext &context, Expression &expr, RE2::Options &t
 
 } // namespace regexp_util
 
+unique_ptr<RegexPrefilter> RegexPrefilter::TryCreate(const RE2 &regex, const string &pattern) {
+	auto &options = regex.options();
+	if (!options.case_sensitive() || options.encoding() != RE2::Options::EncodingUTF8) {
+		return nullptr;
+	}
+	// the atoms of the prefilter are lowercased with unicode case folding, which we do not replicate on the input
+	// we only use the prefilter for ASCII patterns without inline flags (e.g. "(?i)") and without escapes that can
+	// produce non-ASCII characters (e.g. "\x{212A}"), so that all the literals are case-sensitive ASCII
+	for (idx_t i = 0; i < pattern.size(); i++) {
+		auto c = pattern[i];
+		if (uint8_t(c) >= 0x80) {
+			return nullptr;
+		}
+		if (c == '(' && i + 1 < pattern.size() && pattern[i + 1] == '?') {
+			return nullptr;
+		}
+		if (c == '\\' && i + 1 < pattern.size()) {
+			auto escaped = pattern[++i];
+			if (escaped == 'x' || escaped == 'p' || escaped == 'P' || (escaped >= '0' && escaped <= '9')) {
+				return nullptr;
+			}
+		}
+	}
+	unique_ptr<duckdb_re2::Prefilter> prefilter(duckdb_re2::Prefilter::FromRE2(&regex));
+	if (!prefilter) {
+		return nullptr;
+	}
+	auto result = unique_ptr<RegexPrefilter>(new RegexPrefilter());
+	if (!TryConvert(*prefilter, result->root, result->needs_lowercase)) {
+		// every string can match
+		return nullptr;
+	}
+	return result;
+}
+
+bool RegexPrefilter::TryConvert(duckdb_re2::Prefilter &prefilter, PrefilterNode &result, bool &needs_lowercase) {
+	switch (prefilter.op()) {
+	case duckdb_re2::Prefilter::ALL:
+		return false;
+	case duckdb_re2::Prefilter::NONE:
+		result.op = PrefilterOp::NONE;
+		return true;
+	case duckdb_re2::Prefilter::ATOM:
+		result.op = PrefilterOp::ATOM;
+		result.atom = prefilter.atom();
+		if (result.atom.empty()) {
+			return false;
+		}
+		for (auto c : result.atom) {
+			if (uint8_t(c) >= 0x80) {
+				return false;
+			}
+			if (c >= 'a' && c <= 'z') {
+				needs_lowercase = true;
+			}
+		}
+		return true;
+	case duckdb_re2::Prefilter::AND:
+		// children that match everything can be dropped from an AND
+		result.op = PrefilterOp::AND;
+		for (auto &sub : *prefilter.subs()) {
+			PrefilterNode child;
+			if (TryConvert(*sub, child, needs_lowercase)) {
+				result.children.push_back(std::move(child));
+			}
+		}
+		return !result.children.empty();
+	case duckdb_re2::Prefilter::OR:
+		// an OR matches everything if any of its children does
+		result.op = PrefilterOp::OR;
+		for (auto &sub : *prefilter.subs()) {
+			PrefilterNode child;
+			if (!TryConvert(*sub, child, needs_lowercase)) {
+				return false;
+			}
+			result.children.push_back(std::move(child));
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool RegexPrefilter::Evaluate(const PrefilterNode &node, const unsigned char *data, idx_t size) {
+	switch (node.op) {
+	case PrefilterOp::NONE:
+		return false;
+	case PrefilterOp::ATOM:
+		return ContainsFun::Find(data, size, const_uchar_ptr_cast(node.atom.c_str()), node.atom.size()) !=
+		       DConstants::INVALID_INDEX;
+	case PrefilterOp::AND:
+		for (auto &child : node.children) {
+			if (!Evaluate(child, data, size)) {
+				return false;
+			}
+		}
+		return true;
+	default:
+		for (auto &child : node.children) {
+			if (Evaluate(child, data, size)) {
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+bool RegexPrefilter::MayMatch(const string_t &input) {
+	if (!enabled) {
+		return true;
+	}
+	auto data = const_uchar_ptr_cast(input.GetData());
+	auto size = input.GetSize();
+	if (needs_lowercase) {
+		if (lowercase_buffer.size() < size) {
+			lowercase_buffer.resize(size);
+		}
+		auto buffer = lowercase_buffer.data();
+		for (idx_t i = 0; i < size; i++) {
+			auto c = data[i];
+			buffer[i] = c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+		}
+		data = buffer;
+	}
+	auto may_match = Evaluate(root, data, size);
+	checked_count++;
+	if (!may_match) {
+		rejected_count++;
+	}
+	if (checked_count == SAMPLE_SIZE && rejected_count * 10 < checked_count) {
+		// the prefilter rejects less than 10% of the strings: stop paying for it
+		enabled = false;
+	}
+	return may_match;
+}
+
 } // namespace duckdb
@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/aho_corasick.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! AhoCorasick searches a string for a set of patterns in a single pass over the string.
+//! The patterns are compiled into a deterministic automaton over byte classes: bytes that do not occur in any of the
+//! patterns all map to the same class, which keeps the transition table small for typical pattern sets.
+class AhoCorasick {
+public:
+	explicit AhoCorasick(const vector<string> &patterns);
+
+	//! Whether or not the string contains any of the patterns
+	bool ContainsAny(const char *data, idx_t size) const;
+
+private:
+	//! The transition value for transitions into a state in which a pattern was matched
+	static constexpr const uint32_t MATCH = 0xFFFFFFFF;
+
+	//! Whether or not every string matches (i.e. one of the patterns is empty)
+	bool always_match;
+	//! The number of byte classes
+	idx_t class_count;
+	//! Maps every byte to its byte class
+	uint16_t byte_classes[256];
+	//! The transitions of the automaton, indexed by (state * class_count + byte class).
+	//! States are stored as the offset of their first transition in the table.
+	vector<uint32_t> transitions;
+	//! If all patterns start with the same byte we can skip to the next occurrence of that byte from the start state
+	bool single_first_byte;
+	char first_byte;
+};
+
+} // namespace duckdb
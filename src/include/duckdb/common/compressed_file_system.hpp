@@ -10,9 +10,12 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 class CompressedFile;
+class TaskScheduler;
+struct ProducerToken;
 
 struct StreamData {
 	// various buffers & pointers
@@ -29,6 +32,27 @@ struct StreamData {
 	idx_t out_buf_size = 0;
 };
 
+//! The result of locating a block of a compressed file that can be decompressed independently of the rest of the file
+enum class CompressedBlockResult : uint8_t {
+	//! A complete block was found
+	BLOCK,
+	//! More input is required to locate the block
+	INCOMPLETE,
+	//! The input does not start with an independent block of known size
+	UNSUPPORTED,
+	//! The compressed data has ended, the remaining input is ignored
+	END
+};
+
+struct CompressedBlock {
+	//! The offset of the block in the compressed input
+	idx_t offset = 0;
+	idx_t compressed_size = 0;
+	idx_t decompressed_size = 0;
+	//! The offset of the decompressed block in the output
+	idx_t output_offset = 0;
+};
+
 struct StreamWrapper {
 	DUCKDB_API virtual ~StreamWrapper();
 
@@ -54,6 +78,15 @@ public:
 	DUCKDB_API virtual unique_ptr<StreamWrapper> CreateStream() = 0;
 	DUCKDB_API virtual idx_t InBufferSize() = 0;
 	DUCKDB_API virtual idx_t OutBufferSize() = 0;
+
+	//! Whether a file that is opened for reading consists of blocks that can be decompressed independently (e.g. a
+	//! BGZF file), in which case multiple blocks are decompressed in parallel
+	DUCKDB_API virtual bool SupportsBlockDecompression(CompressedFile &file);
+	//! Locates the block at the given offset of the compressed file, of which the input starts at data
+	DUCKDB_API virtual CompressedBlockResult FindBlock(CompressedFile &file, idx_t file_offset, const_data_ptr_t data,
+	                                                   idx_t size, CompressedBlock &result);
+	//! Decompresses a single block that was located by FindBlock - this is called from multiple threads concurrently
+	DUCKDB_API virtual void DecompressBlock(const_data_ptr_t data, const CompressedBlock &block, data_ptr_t out);
 };
 
 class CompressedFile : public FileHandle {
@@ -66,6 +99,9 @@ public:
 	//! Whether the file is opened for reading or for writing
 	bool write = false;
 	StreamData stream_data;
+	//! The scheduler of which idle threads help to decompress blocks, this is set when the file is opened with a
+	//! FileOpener. Without a scheduler, blocks are decompressed by the thread that reads the file.
+	optional_ptr<TaskScheduler> scheduler;
 
 public:
 	DUCKDB_API void Initialize(bool write);
@@ -74,7 +110,40 @@ public:
 	DUCKDB_API void Close() override;
 
 private:
+	//! Reads a batch of blocks and decompresses them in parallel, returns false if the end of the file was reached
+	bool ReadBlocks();
+	void DecompressBlocks(const vector<CompressedBlock> &blocks);
+	//! Resizes the block input buffer, keeping the input that was not decompressed yet
+	void ResizeBlockInput(idx_t new_capacity);
+	//! Decompresses the remainder of the file as a stream, starting from the given offset of the compressed file
+	void StartStream(idx_t file_offset);
+
+private:
+	//! The amount of compressed input that is read per batch of blocks, which grows from the initial size up to the
+	//! maximum size as more of the file is read
+	static constexpr const idx_t INITIAL_BLOCK_INPUT_SIZE = 256ULL << 10ULL;
+	static constexpr const idx_t BLOCK_INPUT_SIZE = 8ULL << 20ULL;
+	//! The maximum amount of decompressed output per batch of blocks
+	static constexpr const idx_t MAX_BLOCK_OUTPUT_SIZE = 64ULL << 20ULL;
+	//! Blocks that are larger than this (e.g. a file that consists of a single zstd frame) are decompressed as a
+	//! stream, as there is nothing to gain from decompressing them separately
+	static constexpr const idx_t MAX_BLOCK_SIZE = 16ULL << 20ULL;
+
 	unique_ptr<StreamWrapper> stream_wrapper;
+	//! The producer of the tasks that decompress blocks, created when the first batch is decompressed in parallel
+	unique_ptr<ProducerToken> producer;
+
+	//! Whether or not the file is decompressed in independent blocks instead of as a stream
+	bool decompress_blocks = false;
+	//! The compressed input of the blocks, which starts at block_input_offset in the compressed file
+	unsafe_unique_array<data_t> block_input;
+	idx_t block_input_capacity = 0;
+	idx_t block_input_offset = 0;
+	idx_t block_input_size = 0;
+	//! The position of the first block in the input that has not been decompressed yet
+	idx_t block_input_position = 0;
+	unsafe_unique_array<data_t> block_output;
+	idx_t block_output_capacity = 0;
 };
 
 } // namespace duckdb
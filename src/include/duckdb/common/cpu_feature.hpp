@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/cpu_feature.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+// Hot vector kernels are compiled for several x86 instruction set extensions, and the best one is picked at runtime
+#if !defined(DUCKDB_DISABLE_SIMD_DISPATCH) && (defined(__x86_64__) || defined(__i386__)) &&                          \
+    (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#define DUCKDB_SIMD_DISPATCH 1
+#endif
+
+namespace duckdb {
+
+//! Instruction set extensions that vector kernels can be compiled for (in increasing order of capability)
+enum class CPUFeature : uint8_t { DEFAULT = 0, SSE42 = 1, AVX2 = 2, AVX512 = 3 };
+
+class CPUFeatures {
+public:
+	//! The most capable instruction set extension that is supported by the CPU and the OS (detected once)
+	DUCKDB_API static CPUFeature GetBestFeature();
+
+private:
+	static CPUFeature DetectBestFeature();
+};
+
+} // namespace duckdb
@@ -231,6 +231,8 @@ enum class UndoFlags : uint32_t;
 
 enum class SetOperationType : uint8_t;
 
+enum class CTEMaterialize : uint8_t;
+
 enum class OptimizerType : uint32_t;
 
 enum class CompressionType : uint8_t;
@@ -559,6 +561,9 @@ const char *EnumUtil::ToChars<UndoFlags>(UndoFlags value);
 template <>
 const char *EnumUtil::ToChars<SetOperationType>(SetOperationType value);
 
+template <>
+const char *EnumUtil::ToChars<CTEMaterialize>(CTEMaterialize value);
+
 template <>
 const char *EnumUtil::ToChars<OptimizerType>(OptimizerType value);
 
@@ -904,6 +909,9 @@ UndoFlags EnumUtil::FromString<UndoFlags>(const char *value);
 template <>
 SetOperationType EnumUtil::FromString<SetOperationType>(const char *value);
 
+template <>
+CTEMaterialize EnumUtil::FromString<CTEMaterialize>(const char *value);
+
 template <>
 OptimizerType EnumUtil::FromString<OptimizerType>(const char *value);
 
@@ -28,6 +28,7 @@ enum class OptimizerType : uint32_t {
 	COMMON_AGGREGATE,
 	COLUMN_LIFETIME,
 	TOP_N,
+	SORT_ELIMINATION,
 	REORDER_FILTER,
 	EXTENSION
 };
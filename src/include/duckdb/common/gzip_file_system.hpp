@@ -31,6 +31,11 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	bool SupportsBlockDecompression(CompressedFile &file) override;
+	CompressedBlockResult FindBlock(CompressedFile &file, idx_t file_offset, const_data_ptr_t data, idx_t size,
+	                                CompressedBlock &result) override;
+	void DecompressBlock(const_data_ptr_t data, const CompressedBlock &block, data_ptr_t out) override;
 };
 
 static constexpr const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
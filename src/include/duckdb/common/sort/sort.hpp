@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! The maximum number of sorted blocks that are merged at once
+	static constexpr idx_t MAX_MERGE_FAN_IN = 64;
 };
 
 struct SortLayout {
@@ -61,7 +63,7 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
-	//! Completes the cascaded merge sort round.
+	//! Completes the merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
 	//! Print the sorted data to the console.
@@ -91,11 +93,17 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
+	//! The number of sorted blocks that are merged into one in the current round
+	idx_t merge_fan_in;
 	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	idx_t group_idx;
+	idx_t num_groups;
+	//! Start of the next partition in each of the sorted blocks of the current group
+	vector<idx_t> run_starts;
+
+private:
+	//! Computes how many sorted blocks can be merged at once
+	idx_t GetMergeFanIn() const;
 };
 
 struct LocalSortState {
@@ -151,7 +159,7 @@ struct MergeSorter {
 public:
 	MergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
 
-	//! Finds and merges partitions until the current cascaded merge round is finished
+	//! Finds and merges partitions until the current merge round is finished
 	void PerformInMergeRound();
 
 private:
@@ -161,38 +169,60 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
+	//! A reader for each of the sorted blocks that are merged
+	vector<unique_ptr<SBScanState>> runs;
+	//! Saved reader indices
+	vector<idx_t> saved_block_indices;
+	vector<idx_t> saved_entry_indices;
 
 	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	vector<unique_ptr<SortedBlock>> inputs;
+	vector<idx_t> input_entry_indices;
 	SortedBlock *result;
 
+	//! Loser tree over the runs
+	vector<idx_t> losers;
+	//! Pointers to the next radix row of each run (nullptr if the run is exhausted)
+	vector<data_ptr_t> run_ptrs;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Computes the slices of the sorted blocks that will be merged next (Merge Path partition)
 	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
+	//! Finds the end of the partition with the given rank in each of the sorted blocks using binary search
+	void GetIntersection(const idx_t rank, const vector<idx_t> &counts, vector<idx_t> &ends);
+	//! Counts the rows of a sorted block that come before the given row of another sorted block
+	idx_t CountBefore(const idx_t run, const idx_t begin, const idx_t end, const idx_t pivot_run,
+	                  const idx_t pivot_idx);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
-	//! Finds the next partition and merges it
+	//! Merges the current partition, with a lower fan-in if pinning a block of each of the runs does not fit in memory
 	void MergePartition();
-
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
+	//! Merges the current partition, merging at most 'fan_in' runs at once
+	void MergePartition(const idx_t fan_in);
+	//! Merges the given runs into the result
+	void MergeRuns(vector<unique_ptr<SortedBlock>> &run_blocks, const vector<idx_t> &entry_indices, const idx_t start,
+	               const idx_t end);
+
+	//! Saves the indices of the readers so they can be restored after merging a part of the data
+	void SaveIndices();
+	//! Restores the saved indices
+	void RestoreIndices();
+	//! Moves the reader past exhausted blocks and pins the next row (returns false if the reader is exhausted)
+	bool PinNextRow(SBScanState &scan);
+	//! Whether the next row of run 'l' comes before the next row of run 'r' (ties are broken by the run index)
+	bool RunIsSmaller(const idx_t l, const idx_t r);
+	//! Initializes the loser tree below the given node, and returns the winner
+	idx_t InitializeLoserTree(const idx_t node);
+
+	//! Computes from which run each of the next 'count' tuples should be taken by setting the 'run_indices' array
+	void ComputeMerge(const idx_t &count, idx_t run_indices[]);
+
+	//! Merges the radix sorting blocks according to the 'run_indices' array
+	void MergeRadix(const idx_t &count, const idx_t run_indices[]);
+	//! Merges SortedData according to the 'run_indices' array
+	void MergeData(SortedData &result_data, const SortedDataType &type, const idx_t &count, const idx_t run_indices[],
+	               bool reset_indices);
 	//! Flushes constant size rows into the result
 	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
 	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
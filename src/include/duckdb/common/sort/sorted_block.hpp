@@ -74,6 +74,8 @@ public:
 	idx_t HeapSize() const;
 	//! Total size (in bytes) of this block
 	idx_t SizeInBytes() const;
+	//! Size (in bytes) of the largest radix block together with its blob and payload blocks (and their heaps)
+	idx_t MaxBlockSizeInBytes() const;
 
 public:
 	//! Radix/memcmp sortable data
@@ -83,6 +85,10 @@ public:
 	//! Payload data
 	unique_ptr<SortedData> payload_data;
 
+private:
+	//! Size (in bytes) of a radix block together with its blob and payload blocks (and their heaps)
+	idx_t BlockSizeInBytes(idx_t block_idx) const;
+
 private:
 	//! Buffer manager, global state, and sorting layout constants
 	BufferManager &buffer_manager;
@@ -10,10 +10,10 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/string_type.hpp"
 
 namespace duckdb {
 
-struct string_t;
 struct interval_t;
 
 // efficient hash function that maximizes the avalanche effect and minimizes
@@ -64,4 +64,51 @@ DUCKDB_API hash_t Hash(interval_t val);
 DUCKDB_API hash_t Hash(const char *val, size_t size);
 DUCKDB_API hash_t Hash(uint8_t *val, size_t size);
 
+//! The constants of the hash function that is used to hash strings (see HashBytes)
+struct StringHashConstants {
+	static constexpr const uint64_t M = UINT64_C(0xc6a4a7935bd1e995);
+	static constexpr const uint64_t SEED = UINT64_C(0xe17a1465);
+	static constexpr const unsigned int R = 47;
+};
+
+//! Hashes a string that is inlined in the string_t. The inlined bytes are zero-padded, so we can load them with
+//! two fixed-size loads instead of looping over the bytes. Hash(const char *, size_t) combines the trailing bytes
+//! in little-endian order, so the loaded tail only matches it on little-endian machines: big-endian machines hash
+//! the bytes with Hash(const char *, size_t) instead. Either way, this gives the same hash as Hash(string_t).
+inline hash_t HashInlinedString(const string_t &val) {
+	D_ASSERT(val.IsInlined());
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return Hash(val.GetData(), val.GetSize());
+#else
+	auto size = val.GetSize();
+	auto data = const_data_ptr_cast(val.GetData());
+	uint64_t h = StringHashConstants::SEED ^ (size * StringHashConstants::M);
+	uint64_t tail;
+	if (size >= sizeof(uint64_t)) {
+		auto k = Load<uint64_t>(data);
+		k *= StringHashConstants::M;
+		k ^= k >> StringHashConstants::R;
+		k *= StringHashConstants::M;
+		h ^= k;
+		h *= StringHashConstants::M;
+		tail = Load<uint32_t>(data + sizeof(uint64_t));
+	} else {
+		tail = Load<uint64_t>(data);
+	}
+	if (size % sizeof(uint64_t) != 0) {
+		h ^= tail;
+		h *= StringHashConstants::M;
+	}
+	h ^= h >> StringHashConstants::R;
+	h *= StringHashConstants::M;
+	h ^= h >> StringHashConstants::R;
+	return h;
+#endif
+}
+
+//! Hashes a string_t, with an inlined fast path for short strings
+inline hash_t HashString(const string_t &val) {
+	return val.IsInlined() ? HashInlinedString(val) : Hash(val.GetData(), val.GetSize());
+}
+
 } // namespace duckdb
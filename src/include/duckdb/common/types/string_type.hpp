@@ -143,7 +143,9 @@ public:
 			}
 			if (!a.IsInlined()) {
 				// 'long' strings of the same length -> compare pointed value
-				if (memcmp(a.value.pointer.ptr, b.value.pointer.ptr, a.GetSize()) == 0) {
+				// the prefixes are equal, so we only need to compare the bytes after the prefix
+				if (memcmp(a.value.pointer.ptr + PREFIX_LENGTH, b.value.pointer.ptr + PREFIX_LENGTH,
+				           a.GetSize() - PREFIX_LENGTH) == 0) {
 					return true;
 				}
 			}
@@ -178,8 +180,13 @@ public:
 
 			if (A != B)
 				return bswap(A) > bswap(B);
+
+			// the prefixes are equal: if both strings are at least as long as the prefix we can skip it
+			const uint32_t offset = min_length >= PREFIX_LENGTH ? PREFIX_LENGTH : 0;
+#else
+			const uint32_t offset = 0;
 #endif
-			auto memcmp_res = memcmp(left.GetData(), right.GetData(), min_length);
+			auto memcmp_res = memcmp(left.GetData() + offset, right.GetData() + offset, min_length - offset);
 			return memcmp_res > 0 || (memcmp_res == 0 && left_length > right_length);
 		}
 	};
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 
 #include <functional>
@@ -113,12 +114,9 @@ struct BinaryExecutor {
 				}
 			}
 		} else {
-			for (idx_t i = 0; i < count; i++) {
-				auto lentry = ldata[LEFT_CONSTANT ? 0 : i];
-				auto rentry = rdata[RIGHT_CONSTANT ? 0 : i];
-				result_data[i] = OPWRAPPER::template Operation<FUNC, OP, LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE>(
-				    fun, lentry, rentry, mask, i);
-			}
+			SIMDDispatcher<SIMDDispatchTypes<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE>::DISPATCH>::template Execute<
+			    LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT, RIGHT_CONSTANT>(
+			    ldata, rdata, result_data, count, mask, fun);
 		}
 	}
 
@@ -368,6 +366,12 @@ public:
 	static inline idx_t SelectFlatLoopSwitch(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata,
 	                                         const SelectionVector *sel, idx_t count, ValidityMask &mask,
 	                                         SelectionVector *true_sel, SelectionVector *false_sel) {
+		if (mask.AllValid()) {
+			return SIMDDispatcher<SIMDDispatchTypes<LEFT_TYPE, RIGHT_TYPE>::DISPATCH>::template Select<
+			    LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(ldata, rdata, sel->data(), count,
+			                                                              true_sel ? true_sel->data() : nullptr,
+			                                                              false_sel ? false_sel->data() : nullptr);
+		}
 		if (true_sel && false_sel) {
 			return SelectFlatLoop<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT, true, true>(
 			    ldata, rdata, sel, count, mask, true_sel, false_sel);
@@ -0,0 +1,238 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/vector_operations/simd_kernels.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/cpu_feature.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
+
+#include <type_traits>
+
+#ifdef DUCKDB_SIMD_DISPATCH
+// The kernel bodies are inlined into a function for each instruction set extension, so they are compiled for each
+#define DUCKDB_SIMD_KERNEL inline __attribute__((always_inline))
+#define DUCKDB_SIMD_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define DUCKDB_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define DUCKDB_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl")))
+#else
+#define DUCKDB_SIMD_KERNEL inline
+#endif
+
+namespace duckdb {
+
+//! Loops over flat vectors without NULL values that benefit from wider registers
+struct SIMDKernels {
+	//! The number of rows of which the comparison results are computed at once during a selection
+	static constexpr idx_t SELECT_BATCH_SIZE = 64;
+
+	//! Computes the selection vectors of a comparison, all rows must be valid
+	//! Note that the (input) selection vector can be the same as one of the result selection vectors
+	template <class LEFT_TYPE, class RIGHT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	static DUCKDB_SIMD_KERNEL idx_t SelectKernel(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata,
+	                                             const sel_t *sel, idx_t count, sel_t *true_sel,
+	                                             sel_t *false_sel) {
+		idx_t true_count = 0;
+		idx_t false_count = 0;
+		uint8_t results[SELECT_BATCH_SIZE];
+		for (idx_t base_idx = 0; base_idx < count; base_idx += SELECT_BATCH_SIZE) {
+			const idx_t next = MinValue<idx_t>(SELECT_BATCH_SIZE, count - base_idx);
+			// Compute the comparison results of the batch first, without any data dependencies between rows
+			idx_t batch_true_count = 0;
+			for (idx_t i = 0; i < next; i++) {
+				results[i] = OP::Operation(ldata[LEFT_CONSTANT ? 0 : base_idx + i],
+				                           rdata[RIGHT_CONSTANT ? 0 : base_idx + i]);
+				batch_true_count += results[i];
+			}
+			if (batch_true_count == 0 || batch_true_count == next) {
+				// All rows of the batch go to the same side: append the indices in bulk
+				auto target_sel = batch_true_count == 0 ? false_sel : true_sel;
+				auto &target_count = batch_true_count == 0 ? false_count : true_count;
+				if (target_sel) {
+					if (sel) {
+						for (idx_t i = 0; i < next; i++) {
+							target_sel[target_count + i] = sel[base_idx + i];
+						}
+					} else {
+						for (idx_t i = 0; i < next; i++) {
+							target_sel[target_count + i] = sel_t(base_idx + i);
+						}
+					}
+				}
+				target_count += next;
+				continue;
+			}
+			// Generate the selection vectors from the comparison results without branches
+			for (idx_t i = 0; i < next; i++) {
+				const sel_t result_idx = sel ? sel[base_idx + i] : sel_t(base_idx + i);
+				if (true_sel) {
+					true_sel[true_count] = result_idx;
+				}
+				if (false_sel) {
+					false_sel[false_count] = result_idx;
+				}
+				true_count += results[i];
+				false_count += 1 - results[i];
+			}
+		}
+		return true_count;
+	}
+
+	//! Executes a binary function on all rows
+	template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OPWRAPPER, class OP, class FUNC,
+	          bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	static DUCKDB_SIMD_KERNEL void ExecuteKernel(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata,
+	                                             RESULT_TYPE *__restrict result_data, idx_t count, ValidityMask &mask,
+	                                             FUNC fun) {
+		for (idx_t i = 0; i < count; i++) {
+			auto lentry = ldata[LEFT_CONSTANT ? 0 : i];
+			auto rentry = rdata[RIGHT_CONSTANT ? 0 : i];
+			result_data[i] =
+			    OPWRAPPER::template Operation<FUNC, OP, LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE>(fun, lentry, rentry, mask, i);
+		}
+	}
+
+#ifdef DUCKDB_SIMD_DISPATCH
+	template <class LEFT_TYPE, class RIGHT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	DUCKDB_SIMD_TARGET_SSE42 static idx_t SelectSSE42(const LEFT_TYPE *__restrict ldata,
+	                                                  const RIGHT_TYPE *__restrict rdata, const sel_t *sel,
+	                                                  idx_t count, sel_t *true_sel,
+	                                                  sel_t *false_sel) {
+		return SelectKernel<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(ldata, rdata, sel, count,
+		                                                                              true_sel, false_sel);
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	DUCKDB_SIMD_TARGET_AVX2 static idx_t SelectAVX2(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata,
+	                                                const sel_t *sel, idx_t count,
+	                                                sel_t *true_sel, sel_t *false_sel) {
+		return SelectKernel<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(ldata, rdata, sel, count,
+		                                                                              true_sel, false_sel);
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	DUCKDB_SIMD_TARGET_AVX512 static idx_t SelectAVX512(const LEFT_TYPE *__restrict ldata,
+	                                                    const RIGHT_TYPE *__restrict rdata,
+	                                                    const sel_t *sel, idx_t count,
+	                                                    sel_t *true_sel, sel_t *false_sel) {
+		return SelectKernel<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(ldata, rdata, sel, count,
+		                                                                              true_sel, false_sel);
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OPWRAPPER, class OP, class FUNC,
+	          bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	DUCKDB_SIMD_TARGET_SSE42 static void ExecuteSSE42(const LEFT_TYPE *__restrict ldata,
+	                                                  const RIGHT_TYPE *__restrict rdata,
+	                                                  RESULT_TYPE *__restrict result_data, idx_t count,
+	                                                  ValidityMask &mask, FUNC fun) {
+		ExecuteKernel<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, result_data, count, mask, fun);
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OPWRAPPER, class OP, class FUNC,
+	          bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	DUCKDB_SIMD_TARGET_AVX2 static void ExecuteAVX2(const LEFT_TYPE *__restrict ldata,
+	                                                const RIGHT_TYPE *__restrict rdata,
+	                                                RESULT_TYPE *__restrict result_data, idx_t count,
+	                                                ValidityMask &mask, FUNC fun) {
+		ExecuteKernel<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, result_data, count, mask, fun);
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OPWRAPPER, class OP, class FUNC,
+	          bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	DUCKDB_SIMD_TARGET_AVX512 static void ExecuteAVX512(const LEFT_TYPE *__restrict ldata,
+	                                                    const RIGHT_TYPE *__restrict rdata,
+	                                                    RESULT_TYPE *__restrict result_data, idx_t count,
+	                                                    ValidityMask &mask, FUNC fun) {
+		ExecuteKernel<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, result_data, count, mask, fun);
+	}
+#endif
+};
+
+//! Dispatches to the kernel that is compiled for the best instruction set extension that the CPU supports
+//! Kernels are only compiled for multiple instruction set extensions for plain numeric types (DISPATCH = true)
+template <bool DISPATCH>
+struct SIMDDispatcher {
+	template <class LEFT_TYPE, class RIGHT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	static idx_t Select(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata, const sel_t *sel,
+	                    idx_t count, sel_t *true_sel, sel_t *false_sel) {
+		return SIMDKernels::SelectKernel<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, sel, count, true_sel, false_sel);
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OPWRAPPER, class OP, class FUNC,
+	          bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	static void Execute(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata,
+	                    RESULT_TYPE *__restrict result_data, idx_t count, ValidityMask &mask, FUNC fun) {
+		SIMDKernels::ExecuteKernel<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT,
+		                           RIGHT_CONSTANT>(ldata, rdata, result_data, count, mask, fun);
+	}
+};
+
+#ifdef DUCKDB_SIMD_DISPATCH
+template <>
+struct SIMDDispatcher<true> {
+	template <class LEFT_TYPE, class RIGHT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	static idx_t Select(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata, const sel_t *sel,
+	                    idx_t count, sel_t *true_sel, sel_t *false_sel) {
+		switch (CPUFeatures::GetBestFeature()) {
+		case CPUFeature::AVX512:
+			return SIMDKernels::SelectAVX512<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+			    ldata, rdata, sel, count, true_sel, false_sel);
+		case CPUFeature::AVX2:
+			return SIMDKernels::SelectAVX2<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+			    ldata, rdata, sel, count, true_sel, false_sel);
+		case CPUFeature::SSE42:
+			return SIMDKernels::SelectSSE42<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+			    ldata, rdata, sel, count, true_sel, false_sel);
+		default:
+			return SIMDKernels::SelectKernel<LEFT_TYPE, RIGHT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+			    ldata, rdata, sel, count, true_sel, false_sel);
+		}
+	}
+
+	template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OPWRAPPER, class OP, class FUNC,
+	          bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+	static void Execute(const LEFT_TYPE *__restrict ldata, const RIGHT_TYPE *__restrict rdata,
+	                    RESULT_TYPE *__restrict result_data, idx_t count, ValidityMask &mask, FUNC fun) {
+		switch (CPUFeatures::GetBestFeature()) {
+		case CPUFeature::AVX512:
+			SIMDKernels::ExecuteAVX512<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT,
+			                           RIGHT_CONSTANT>(ldata, rdata, result_data, count, mask, fun);
+			break;
+		case CPUFeature::AVX2:
+			SIMDKernels::ExecuteAVX2<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT,
+			                         RIGHT_CONSTANT>(ldata, rdata, result_data, count, mask, fun);
+			break;
+		case CPUFeature::SSE42:
+			SIMDKernels::ExecuteSSE42<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT,
+			                          RIGHT_CONSTANT>(ldata, rdata, result_data, count, mask, fun);
+			break;
+		default:
+			SIMDKernels::ExecuteKernel<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OPWRAPPER, OP, FUNC, LEFT_CONSTANT,
+			                           RIGHT_CONSTANT>(ldata, rdata, result_data, count, mask, fun);
+			break;
+		}
+	}
+};
+#endif
+
+//! Whether kernels are compiled for multiple instruction set extensions for the given types
+template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE = bool>
+struct SIMDDispatchTypes {
+#ifdef DUCKDB_SIMD_DISPATCH
+	static constexpr bool DISPATCH = std::is_arithmetic<LEFT_TYPE>::value && std::is_arithmetic<RIGHT_TYPE>::value &&
+	                                 std::is_arithmetic<RESULT_TYPE>::value;
+#else
+	static constexpr bool DISPATCH = false;
+#endif
+};
+
+} // namespace duckdb
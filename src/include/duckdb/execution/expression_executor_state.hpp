@@ -18,6 +18,7 @@ class Expression;
 class ExpressionExecutor;
 struct ExpressionExecutorState;
 struct FunctionLocalState;
+class FusedExpression;
 
 struct ExpressionState {
 	ExpressionState(const Expression &expr, ExpressionExecutorState &root);
@@ -58,6 +59,8 @@ struct ExecuteFunctionState : public ExpressionState {
 	~ExecuteFunctionState();
 
 	unique_ptr<FunctionLocalState> local_state;
+	//! The fused program evaluating the expression tree in a single pass, if the tree could be fused
+	unique_ptr<FusedExpression> fused_expression;
 
 public:
 	static optional_ptr<FunctionLocalState> GetFunctionState(ExpressionState &state) {
@@ -71,6 +74,8 @@ struct ExpressionExecutorState {
 	unique_ptr<ExpressionState> root_state;
 	ExpressionExecutor *executor = nullptr;
 	CycleCounter profiler;
+	//! Whether the states that are being initialized belong to a tree that is evaluated by a fused program
+	bool in_fused_tree = false;
 
 	void Verify();
 };
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/fused_expression.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class BoundFunctionExpression;
+class Expression;
+
+enum class FusedOperandType : uint8_t { REGISTER, COLUMN, CONSTANT };
+
+//! An input of a fused instruction: an intermediate result, a column of the input chunk or a constant
+struct FusedOperand {
+	FusedOperandType type;
+	idx_t index;
+};
+
+enum class FusedOpcode : uint8_t { ADD, SUBTRACT, MULTIPLY };
+
+//! A single arithmetic operation of a fused program, the result is written to the register with the same index
+struct FusedInstruction {
+	FusedOpcode opcode;
+	FusedOperand left;
+	FusedOperand right;
+};
+
+//! A FusedExpression evaluates a tree of numeric +, - and * operators in a single pass over the input.
+//! The tree is compiled into a small program that is interpreted over cache-resident batches of rows, instead of
+//! materializing a full intermediate vector for every operator in the tree.
+class FusedExpression {
+public:
+	//! The number of rows that are evaluated at once, the registers of a batch fit in the L1 cache
+	static constexpr const idx_t BATCH_SIZE = 128;
+	//! The maximum number of operators in a fused tree
+	static constexpr const idx_t MAX_INSTRUCTIONS = 16;
+
+	//! Compiles the expression into a fused program, or returns nullptr if the expression cannot be fused
+	static unique_ptr<FusedExpression> TryCompile(const BoundFunctionExpression &expr);
+
+	//! Evaluates the program over the input chunk. Returns false (without writing to the result) if the input cannot
+	//! be handled by the fused program, e.g. because it contains NULL values, in which case the expression should be
+	//! evaluated as usual.
+	bool TryExecute(DataChunk &input, idx_t count, Vector &result);
+
+private:
+	explicit FusedExpression(PhysicalType type);
+
+	FusedOperand Compile(const Expression &expr);
+	template <class T, class ADD, class SUBTRACT, class MULTIPLY>
+	bool TemplatedExecute(DataChunk &input, idx_t count, Vector &result);
+
+private:
+	//! The physical type of all operators in the program
+	PhysicalType type;
+	//! The instructions in evaluation order, the last instruction computes the result
+	vector<FusedInstruction> instructions;
+	//! The input columns referenced by the program
+	vector<idx_t> columns;
+	//! The constants referenced by the program
+	vector<Value> constants;
+	//! The registers holding the intermediate results (and the broadcasted constants) of a batch
+	unsafe_unique_array<data_t> registers;
+};
+
+} // namespace duckdb
@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/merge_sort_tree.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <functional>
+
+namespace duckdb {
+
+//! A MergeSortTree is a static range index over a sequence of elements.
+//! Level 0 holds the elements in their original order, and each level above holds
+//! sorted runs that are FANOUT times longer than the runs of the level below.
+//! A positional range [lower, upper) decomposes into O(FANOUT * log(n)) runs,
+//! each of which can be binary searched, so range counting and range selection
+//! queries take polylogarithmic time instead of time linear in the range size.
+//! See "Efficient Processing of Window Functions in Analytical SQL Queries" (Leis et al.)
+template <typename E = idx_t, typename CMP = std::less<E>>
+class MergeSortTree {
+public:
+	using Elements = vector<E>;
+	using Level = Elements;
+
+	//! The number of runs of one level that are merged into a run of the next level
+	static constexpr idx_t FANOUT = 32;
+
+	explicit MergeSortTree(Elements &&lowest_level, const CMP &cmp_p = CMP()) : cmp(cmp_p) {
+		const auto count = lowest_level.size();
+		tree.emplace_back(std::move(lowest_level));
+
+		// Levels with runs longer than the input are never used by queries
+		for (idx_t child_run = 1; child_run * FANOUT <= count; child_run *= FANOUT) {
+			const auto run_length = child_run * FANOUT;
+			Level level(tree.back());
+			for (idx_t run_begin = 0; run_begin < count; run_begin += run_length) {
+				const auto run_end = MinValue(run_begin + run_length, count);
+				// Merge the (already sorted) child runs pairwise until the whole run is sorted
+				for (idx_t width = child_run; width < run_end - run_begin; width *= 2) {
+					for (idx_t lo = run_begin; lo + width < run_end; lo += 2 * width) {
+						const auto mid = lo + width;
+						const auto hi = MinValue(mid + width, run_end);
+						std::inplace_merge(level.begin() + lo, level.begin() + mid, level.begin() + hi, cmp);
+					}
+				}
+			}
+			tree.emplace_back(std::move(level));
+		}
+	}
+
+	//! The number of elements in the tree
+	idx_t size() const { // NOLINT: match the STL naming
+		return tree[0].size();
+	}
+
+	//! The element at the given position in the original order
+	const E &operator[](idx_t pos) const {
+		return tree[0][pos];
+	}
+
+	//! Calls aggregate(level, run_begin, run_end) for each sorted run in the decomposition of [lower, upper),
+	//! where tree[level][run_begin, run_end) are the elements of that run that compare less than needle.
+	template <typename L>
+	void AggregateLowerBound(idx_t lower, idx_t upper, const E &needle, L aggregate) const {
+		D_ASSERT(lower <= upper && upper <= size());
+
+		idx_t run_length = 1;
+		for (idx_t level_no = 0; lower < upper; ++level_no, run_length *= FANOUT) {
+			D_ASSERT(level_no < tree.size());
+			const auto &level = tree[level_no];
+			const auto group_length = run_length * FANOUT;
+
+			// Left edge: the runs before the next boundary of the level above
+			for (; lower < upper && lower % group_length; lower += run_length) {
+				LowerBoundRun(level_no, level, lower, lower + run_length, needle, aggregate);
+			}
+
+			// Right edge: the runs after the last boundary of the level above
+			for (; lower < upper && upper % group_length; upper -= run_length) {
+				LowerBoundRun(level_no, level, upper - run_length, upper, needle, aggregate);
+			}
+		}
+	}
+
+	//! The number of elements in [lower, upper) that compare less than needle
+	idx_t CountLowerBound(idx_t lower, idx_t upper, const E &needle) const {
+		idx_t result = 0;
+		AggregateLowerBound(lower, upper, needle,
+		                    [&](idx_t level, idx_t run_begin, idx_t run_end) { result += run_end - run_begin; });
+		return result;
+	}
+
+	//! The number of elements that lie in [lower, upper)
+	idx_t CountRange(const E &lower, const E &upper) const {
+		// The runs of the top level hold all the elements
+		const auto &level = tree.back();
+		const auto run_length = TopRunLength();
+		idx_t result = 0;
+		for (idx_t run_begin = 0; run_begin < size(); run_begin += run_length) {
+			result += CountRun(level, run_begin, MinValue(run_begin + run_length, size()), lower, upper);
+		}
+		return result;
+	}
+
+	//! The position in the lowest level of the nth (0-based) element that lies in [lower, upper).
+	//! Starting from the top level, this descends into the run that holds that element.
+	idx_t SelectNth(const E &lower, const E &upper, idx_t n) const {
+		D_ASSERT(n < CountRange(lower, upper));
+
+		idx_t begin = 0;
+		idx_t end = size();
+		auto run_length = TopRunLength();
+		for (idx_t level_no = tree.size(); level_no-- > 0; run_length /= FANOUT) {
+			const auto &level = tree[level_no];
+			for (auto run_begin = begin; run_begin < end; run_begin += run_length) {
+				const auto run_end = MinValue(run_begin + run_length, end);
+				const auto count = CountRun(level, run_begin, run_end, lower, upper);
+				if (n < count) {
+					begin = run_begin;
+					end = run_end;
+					break;
+				}
+				n -= count;
+			}
+		}
+		return begin;
+	}
+
+	//! The tree levels
+	vector<Level> tree;
+	//! The element comparison
+	CMP cmp;
+
+private:
+	//! The length of the runs of the top level
+	idx_t TopRunLength() const {
+		idx_t run_length = 1;
+		for (idx_t level_no = 1; level_no < tree.size(); ++level_no) {
+			run_length *= FANOUT;
+		}
+		return run_length;
+	}
+
+	//! The number of elements of the sorted run level[run_begin, run_end) that lie in [lower, upper)
+	inline idx_t CountRun(const Level &level, idx_t run_begin, idx_t run_end, const E &lower, const E &upper) const {
+		const auto begin = level.begin() + run_begin;
+		const auto end = level.begin() + run_end;
+		const auto first = std::lower_bound(begin, end, lower, cmp);
+		return std::lower_bound(first, end, upper, cmp) - first;
+	}
+
+	template <typename L>
+	inline void LowerBoundRun(idx_t level_no, const Level &level, idx_t run_begin, idx_t run_end, const E &needle,
+	                          L &aggregate) const {
+		const auto begin = level.begin() + run_begin;
+		const auto end = level.begin() + run_end;
+		const auto bound = std::lower_bound(begin, end, needle, cmp);
+		if (bound != begin) {
+			aggregate(level_no, run_begin, run_begin + (bound - begin));
+		}
+	}
+};
+
+} // namespace duckdb
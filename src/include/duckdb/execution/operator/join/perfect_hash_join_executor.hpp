@@ -20,13 +20,17 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The key domains, one entry per join condition
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
+	//! The multiplier of each (key - min) in the perfect hash table index
+	vector<idx_t> key_strides;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The number of perfect hash table entries minus one
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -44,21 +48,18 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	//! Adds the contribution of the key column key_idx to the perfect hash table indexes,
+	//! and clears in_domain for NULL keys and keys outside of the build domain
+	void FillKeyIndexesSwitch(Vector &source, idx_t key_idx, idx_t count, idx_t indexes[], bool in_domain[]);
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	void TemplatedFillKeyIndexes(Vector &source, idx_t key_idx, idx_t count, idx_t indexes[], bool in_domain[]);
+	//! Computes the perfect hash table indexes of a set of key columns
+	void FillKeyIndexes(Vector keys[], idx_t count, idx_t indexes[], bool in_domain[]);
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	bool FullScanHashTable();
 
 private:
 	const PhysicalHashJoin &join;
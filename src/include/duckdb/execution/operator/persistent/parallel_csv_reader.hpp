@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/execution/operator/persistent/base_csv_reader.hpp"
 #include "duckdb/execution/operator/persistent/csv_reader_options.hpp"
 #include "duckdb/execution/operator/persistent/csv_file_handle.hpp"
@@ -19,6 +20,68 @@
 
 namespace duckdb {
 
+//! Searches a CSV buffer for the next occurrence of any of (up to four) characters. The buffer is scanned eight bytes
+//! at a time, by testing a whole word for all of the characters at once.
+//! Unlike the SIMDKernels, this is not compiled per instruction set: the parser calls Find for every value, and most
+//! values are shorter than a vector register, so the search has to be inlined into the parser rather than dispatched.
+struct CSVCharacterSearch {
+	static constexpr const idx_t MAX_CHARACTERS = 4;
+
+	CSVCharacterSearch() : CSVCharacterSearch(vector<char> {'\n'}) {
+	}
+	explicit CSVCharacterSearch(const vector<char> &characters) {
+		D_ASSERT(!characters.empty() && characters.size() <= MAX_CHARACTERS);
+		memset(is_character, 0, sizeof(is_character));
+		for (idx_t i = 0; i < MAX_CHARACTERS; i++) {
+			// unused slots repeat the first character, so Matches always tests MAX_CHARACTERS characters
+			auto c = uint8_t(characters[i < characters.size() ? i : 0]);
+			broadcast[i] = 0x0101010101010101ULL * c;
+			is_character[c] = true;
+		}
+	}
+
+	//! Returns the first position in [position, end) of one of the characters, or end if there is none
+	inline idx_t Find(const char *data, idx_t position, idx_t end) const {
+		while (position + sizeof(uint64_t) <= end) {
+			uint64_t word;
+			memcpy(&word, data + position, sizeof(uint64_t));
+			auto matches = Matches(word);
+			if (matches) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+				// the lowest match is exact, so it tells us the position of the first character
+				return position + CountZeros<uint64_t>::Trailing(matches) / 8;
+#else
+				break;
+#endif
+			}
+			position += sizeof(uint64_t);
+		}
+		for (; position < end; position++) {
+			if (is_character[uint8_t(data[position])]) {
+				return position;
+			}
+		}
+		return end;
+	}
+
+private:
+	//! Returns a mask with the high bit set of the bytes of the word that are one of the characters. Only the lowest
+	//! set bit is exact: a matching byte can cause false positives in the more significant bytes.
+	inline uint64_t Matches(uint64_t word) const {
+		// a byte of word ^ broadcast is zero iff the byte equals the character, and (x - 0x01..) & ~x & 0x80.. sets
+		// the high bit of the lowest zero byte of x
+		uint64_t result = 0;
+		for (idx_t i = 0; i < MAX_CHARACTERS; i++) {
+			auto x = word ^ broadcast[i];
+			result |= (x - 0x0101010101010101ULL) & ~x;
+		}
+		return result & 0x8080808080808080ULL;
+	}
+
+	uint64_t broadcast[MAX_CHARACTERS];
+	bool is_character[256];
+};
+
 struct CSVBufferRead {
 	CSVBufferRead(shared_ptr<CSVBuffer> buffer_p, idx_t buffer_start_p, idx_t buffer_end_p, idx_t batch_index,
 	              idx_t local_batch_index_p, optional_ptr<LineInfo> line_info_p)
@@ -43,6 +106,20 @@ struct CSVBufferRead {
 
 	CSVBufferRead() : buffer_start(0), buffer_end(NumericLimits<idx_t>::Maximum()) {};
 
+	//! Returns the first position in [position, end) that holds one of the characters of the search, or end
+	idx_t Find(const CSVCharacterSearch &search, idx_t position, idx_t end) const {
+		auto buffer_size = buffer->GetBufferSize();
+		if (position < buffer_size) {
+			auto result = search.Find(buffer->Ptr(), position, MinValue<idx_t>(end, buffer_size));
+			if (result < buffer_size || end <= buffer_size) {
+				return result;
+			}
+			position = buffer_size;
+		}
+		D_ASSERT(next_buffer);
+		return buffer_size + search.Find(next_buffer->Ptr(), position - buffer_size, end - buffer_size);
+	}
+
 	const char &operator[](size_t i) const {
 		if (i < buffer->GetBufferSize()) {
 			auto buffer_ptr = buffer->Ptr();
@@ -167,6 +244,9 @@ private:
 
 	//! First Position of First Buffer
 	idx_t first_pos_first_buffer = 0;
+	//! Searches for the characters that end an unquoted value, and for the characters that matter in a quoted value
+	CSVCharacterSearch unquoted_search;
+	CSVCharacterSearch quoted_search;
 };
 
 } // namespace duckdb
@@ -29,12 +29,25 @@ public:
 
 public:
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
 	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+	idx_t GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+	                    LocalSourceState &lstate) const override;
 
 	bool IsSource() const override {
 		return true;
 	}
 
+	//! Scans of a (recursive) CTE are parallel, the CTE is not modified while it is being scanned
+	bool ParallelSource() const override {
+		return type == PhysicalOperatorType::CTE_SCAN || type == PhysicalOperatorType::RECURSIVE_CTE_SCAN;
+	}
+
+	bool SupportsBatchIndex() const override {
+		return ParallelSource();
+	}
+
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 };
@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/set/physical_cte.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+//! PhysicalCTE materializes the result of a CTE (the first child) once, after which it is scanned by all CTE_SCAN
+//! operators in the remainder of the query (the second child)
+class PhysicalCTE : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CTE;
+
+public:
+	PhysicalCTE(string ctename, idx_t table_index, vector<LogicalType> types, unique_ptr<PhysicalOperator> top,
+	            unique_ptr<PhysicalOperator> bottom, idx_t estimated_cardinality);
+	~PhysicalCTE() override;
+
+	//! The collection that holds the materialized CTE
+	std::shared_ptr<ColumnDataCollection> working_table;
+	//! The scans of the materialized CTE
+	vector<const_reference<PhysicalOperator>> cte_scans;
+
+	idx_t table_index;
+	string ctename;
+	//! Whether or not the CTE can be materialized in parallel (i.e. the insertion order does not have to be preserved)
+	bool parallel = false;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const override;
+
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return parallel;
+	}
+
+	bool SinkOrderDependent() const override {
+		return !parallel;
+	}
+
+	string ParamsToString() const override;
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+
+	vector<const_reference<PhysicalOperator>> GetSources() const override;
+};
+
+} // namespace duckdb
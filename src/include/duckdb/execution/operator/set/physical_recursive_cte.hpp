@@ -13,7 +13,8 @@
 
 namespace duckdb {
 
-class RecursiveCTEState;
+class RecursiveCTELocalState;
+struct RecursiveCTEPartition;
 
 class PhysicalRecursiveCTE : public PhysicalOperator {
 public:
@@ -40,20 +41,28 @@ public:
 	// Sink interface
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 
+	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const override;
+
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 
 	bool IsSink() const override {
 		return true;
 	}
 
+	bool ParallelSink() const override {
+		return true;
+	}
+
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 
 	vector<const_reference<PhysicalOperator>> GetSources() const override;
 
 private:
-	//! Probe Hash Table and eliminate duplicate rows
-	idx_t ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const;
+	//! Probe a partition of the Hash Table and eliminate duplicate rows
+	idx_t ProbeHT(DataChunk &chunk, Vector &hashes, RecursiveCTEPartition &partition,
+	              RecursiveCTELocalState &lstate) const;
 
 	void ExecuteRecursivePipelines(ExecutionContext &context) const;
 };
@@ -51,6 +51,10 @@ public:
 	//! The estimated cardinality of this physical operator
 	idx_t estimated_cardinality;
 	unique_ptr<EstimatedProperties> estimated_props;
+	//! The key under which the output cardinality of this operator is recorded for cardinality feedback (if any)
+	string feedback_key;
+	//! The cardinality of the unfiltered base table of the feedback key
+	idx_t feedback_base_cardinality = 0;
 
 	//! The global sink state of this operator
 	unique_ptr<GlobalSinkState> sink_state;
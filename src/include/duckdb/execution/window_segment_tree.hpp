@@ -13,6 +13,7 @@
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/execution/merge_sort_tree.hpp"
 
 namespace duckdb {
 
@@ -67,6 +68,56 @@ private:
 	idx_t row;
 };
 
+class WindowDistinctAggregate : public WindowAggregateState {
+public:
+	WindowDistinctAggregate(AggregateObject aggr, const LogicalType &result_type_p, const ValidityMask &filter_mask,
+	                        ClientContext &context);
+	~WindowDistinctAggregate() override;
+
+	void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) override;
+	void Finalize() override;
+	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end) override;
+
+private:
+	//! (previous row with the same arguments + 1, row). The previous row is 0 if there is none.
+	using PrevRow = std::pair<idx_t, idx_t>;
+	using DistinctTree = MergeSortTree<PrevRow>;
+
+	//! Builds the aggregate states of the prefixes of the sorted runs of the distinct tree
+	void ConstructStates();
+	//! Updates the aggregate state with the rows in distinct_rows
+	void UpdateRows();
+	//! Combines the states in prefix_states into the aggregate state
+	void CombineStates();
+
+	//! The client context, used for building the hash table
+	ClientContext &context;
+	//! The filtered rows in the payload
+	const ValidityMask &filter_mask;
+	//! Only count the distinct values, don't update the aggregate
+	const bool count_only;
+	//! Merge sort tree over the previous occurrence of each row's arguments
+	unique_ptr<DistinctTree> distinct_tree;
+	//! Whether the aggregate is computed by combining the prefix states of the runs. Otherwise, the rows that are the
+	//! first occurrence of their value are aggregated one by one.
+	bool use_prefix_states = false;
+	//! For each level of the distinct tree above the lowest level, and for each element of that level, the aggregate
+	//! state of the rows of its sorted run up to and including that element
+	unsafe_unique_array<data_t> levels_flat_native;
+	//! The number of states in levels_flat_native
+	idx_t internal_nodes = 0;
+	//! The rows that are the first occurrence of their value in the current frame
+	vector<idx_t> distinct_rows;
+	//! The prefix states that hold the other first occurrences in the current frame
+	vector<data_ptr_t> prefix_states;
+	//! Selection of a batch of distinct_rows
+	SelectionVector distinct_sel;
+	//! The arguments of a batch of distinct_rows
+	DataChunk frame;
+	//! A vector of pointers to a batch of states
+	Vector statel;
+};
+
 class WindowSegmentTree {
 public:
 	using FrameBounds = std::pair<idx_t, idx_t>;
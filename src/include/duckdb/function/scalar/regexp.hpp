@@ -13,6 +13,10 @@
 #include "duckdb/function/built_in_functions.hpp"
 #include "re2/stringpiece.h"
 
+namespace duckdb_re2 {
+class Prefilter;
+}
+
 namespace duckdb {
 
 namespace regexp_util {
@@ -133,6 +137,45 @@ public:
 	duckdb_re2::StringPiece *group_buffer;
 };
 
+//! The RegexPrefilter quickly rejects strings that cannot match a regex. It uses the prefilter of RE2 to extract the
+//! literal substrings that any match of the regex must contain, and searches for them before running the regex.
+class RegexPrefilter {
+public:
+	//! Creates a prefilter for the regex, or returns nullptr if no (safe) prefilter can be derived from the regex
+	static unique_ptr<RegexPrefilter> TryCreate(const RE2 &regex, const string &pattern);
+
+	//! Returns false if the input definitely does not match the regex
+	bool MayMatch(const string_t &input);
+
+private:
+	enum class PrefilterOp : uint8_t { NONE, ATOM, AND, OR };
+
+	struct PrefilterNode {
+		PrefilterOp op;
+		string atom;
+		vector<PrefilterNode> children;
+	};
+
+	//! The number of strings after which we check whether the prefilter rejects enough strings to be worth it
+	static constexpr const idx_t SAMPLE_SIZE = 4096;
+
+	RegexPrefilter() : needs_lowercase(false), enabled(true), checked_count(0), rejected_count(0) {
+	}
+
+	static bool TryConvert(duckdb_re2::Prefilter &prefilter, PrefilterNode &result, bool &needs_lowercase);
+	static bool Evaluate(const PrefilterNode &node, const unsigned char *data, idx_t size);
+
+private:
+	PrefilterNode root;
+	//! The atoms of the RE2 prefilter are lowercase, so (if they contain letters) we search in the lowercased input
+	bool needs_lowercase;
+	vector<unsigned char> lowercase_buffer;
+	//! The prefilter disables itself if it rejects too few strings
+	bool enabled;
+	idx_t checked_count;
+	idx_t rejected_count;
+};
+
 struct RegexLocalState : public FunctionLocalState {
 	explicit RegexLocalState(RegexpBaseBindData &info, bool extract_all = false)
 	    : constant_pattern(duckdb_re2::StringPiece(info.constant_string.c_str(), info.constant_string.size()),
@@ -144,11 +187,21 @@ struct RegexLocalState : public FunctionLocalState {
 			}
 		}
 		D_ASSERT(info.constant_pattern);
+		if (constant_pattern.ok()) {
+			prefilter = RegexPrefilter::TryCreate(constant_pattern, info.constant_string);
+		}
 	}
 
 	RE2 constant_pattern;
 	//! Used by regexp_extract_all to pre-allocate the args
 	RegexStringPieceArgs group_buffer;
+	//! Used to reject strings that cannot match the constant pattern without running the regex
+	unique_ptr<RegexPrefilter> prefilter;
+
+public:
+	bool MayMatch(const string_t &input) {
+		return !prefilter || prefilter->MayMatch(input);
+	}
 };
 
 unique_ptr<FunctionLocalState> RegexInitLocalState(ExpressionState &state, const BoundFunctionExpression &expr,
@@ -121,6 +121,12 @@ struct ContainsFun {
 	                  idx_t needle_size);
 };
 
+//! contains_any(string, patterns) checks whether the string contains any of a constant list of patterns in a single
+//! pass over the string. The optimizer creates it from disjunctions of contains calls on the same string.
+struct ContainsAnyFun {
+	static ScalarFunction GetFunction();
+};
+
 struct RegexpFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -30,6 +30,8 @@ struct ClientConfig {
 	bool enable_profiler = false;
 	//! If detailed query profiling is enabled
 	bool enable_detailed_profiling = false;
+	//! If the observed cardinalities of filtered table scans are recorded and used for cardinality estimation
+	bool enable_cardinality_feedback = false;
 	//! The format to print query profiling information in (default: query_tree), if enabled.
 	ProfilerPrintFormat profiler_print_format = ProfilerPrintFormat::QUERY_TREE;
 	//! The file to save query profiling information to, instead of printing it to the console
@@ -148,6 +148,9 @@ private:
 
 public:
 	DUCKDB_API bool IsEnabled() const;
+	//! Whether or not the operators are profiled, which is the case if profiling is enabled or if the observed
+	//! cardinalities are recorded for cardinality feedback
+	DUCKDB_API bool IsCollecting() const;
 	DUCKDB_API bool IsDetailedEnabled() const;
 	DUCKDB_API ProfilerPrintFormat GetPrintFormat() const;
 	DUCKDB_API bool PrintOptimizerOutput() const;
@@ -156,7 +159,7 @@ public:
 	DUCKDB_API static QueryProfiler &Get(ClientContext &context);
 
 	DUCKDB_API void StartQuery(string query, bool is_explain_analyze = false, bool start_at_optimizer = false);
-	DUCKDB_API void EndQuery();
+	DUCKDB_API void EndQuery(bool success = true);
 
 	DUCKDB_API void StartExplainAnalyze();
 
@@ -131,6 +131,17 @@ struct DisabledOptimizersSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct EnableCardinalityFeedbackSetting {
+	static constexpr const char *Name = "enable_cardinality_feedback";
+	static constexpr const char *Description =
+	    "Records the observed cardinalities of filtered table scans and uses them to estimate cardinalities and order "
+	    "joins of subsequent queries";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct EnableExternalAccessSetting {
 	static constexpr const char *Name = "enable_external_access";
 	static constexpr const char *Description =
@@ -29,11 +29,15 @@ public:
 private:
 	//! First iteration: count how many times each expression occurs
 	void CountExpressions(Expression &expr, CSEReplacementState &state);
+	//! Count the expressions that are evaluated for every row the expression is evaluated for
+	void CountUnconditionalExpressions(Expression &expr, CSEReplacementState &state);
 	//! Second iteration: perform the actual replacement of the duplicate expressions with common subexpressions nodes
 	void PerformCSEReplacement(unique_ptr<Expression> &expr, CSEReplacementState &state);
 
 	//! Main method to extract common subexpressions
 	void ExtractCommonSubExpresions(LogicalOperator &op);
+	//! Extract the expressions that are computed both by a filter and by the operator on top of the filter
+	void ExtractFilterSubExpressions(LogicalOperator &op);
 
 private:
 	Binder &binder;
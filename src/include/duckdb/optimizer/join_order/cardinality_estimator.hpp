@@ -8,12 +8,14 @@
 #pragma once
 
 #include "duckdb/optimizer/join_order/join_node.hpp"
+#include "duckdb/optimizer/join_order/join_relation.hpp"
 #include "duckdb/planner/column_binding.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 
 namespace duckdb {
+class CardinalityFeedback;
 
 struct RelationAttributes {
 	string original_name;
@@ -67,6 +69,11 @@ private:
 	column_binding_map_t<ColumnBinding> relation_column_to_original_column;
 
 	vector<RelationsToTDom> relations_to_tdoms;
+	//! The observed cardinalities of previous queries (if cardinality feedback is enabled)
+	shared_ptr<CardinalityFeedback> feedback;
+	//! The feedback key and base cardinality of every relation, indexed by relation id
+	vector<string> feedback_keys;
+	vector<idx_t> feedback_base_cardinalities;
 
 public:
 	static constexpr double DEFAULT_SELECTIVITY = 0.2;
@@ -89,6 +96,9 @@ public:
 	void UpdateTotalDomains(JoinNode &node, LogicalOperator &op);
 	void InitEquivalentRelations(vector<unique_ptr<FilterInfo>> &filter_infos);
 
+	//! Computes the cardinality feedback keys of the relations. This has to happen before the filters are extracted
+	//! from the plan, since the keys are derived from the filters on top of each relation.
+	void InitFeedbackKeys(vector<unique_ptr<SingleJoinRelation>> &relations);
 	void InitCardinalityEstimatorProps(vector<NodeOp> &node_ops, vector<unique_ptr<FilterInfo>> &filter_infos);
 	double EstimateCardinalityWithSet(JoinRelationSet &new_set);
 	void EstimateBaseTableCardinality(JoinNode &node, LogicalOperator &op);
@@ -107,6 +117,8 @@ private:
 	void AddToEquivalenceSets(FilterInfo *filter_info, vector<idx_t> matching_equivalent_sets);
 
 	optional_ptr<TableFilterSet> GetTableFilters(LogicalOperator &op, idx_t table_index);
+	//! Looks up the observed cardinality of a base relation in the cardinality feedback
+	bool TryGetFeedbackCardinality(idx_t relation_id, double &result);
 
 	void AddRelationTdom(FilterInfo &filter_info);
 	bool EmptyFilter(FilterInfo &filter_info);
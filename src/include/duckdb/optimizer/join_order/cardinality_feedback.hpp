@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+
+//! CardinalityFeedback stores the selectivities of filtered base relations that were observed while executing
+//! queries. The selectivities are keyed by the scanned table together with the (normalized) filters on that table, so
+//! that repeated queries with the same predicates use the observed numbers instead of the default selectivities when
+//! estimating cardinalities and ordering joins.
+class CardinalityFeedback : public ObjectCacheEntry {
+public:
+	//! The maximum number of relations for which we keep feedback
+	static constexpr const idx_t MAXIMUM_ENTRIES = 10000;
+
+public:
+	static string ObjectType() {
+		return "cardinality_feedback";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! Whether or not cardinality feedback is enabled for the client
+	static bool IsEnabled(ClientContext &context);
+	//! Returns the feedback store of the database, or nullptr if cardinality feedback is not enabled
+	static shared_ptr<CardinalityFeedback> Get(ClientContext &context);
+
+	//! Returns the feedback key of a filtered scan of a table (a LogicalGet with table filters, optionally below a
+	//! chain of LogicalFilters), or an empty string if the operator is not a filtered table scan. The cardinality of
+	//! the unfiltered table is written to base_cardinality.
+	static string GetRelationKey(ClientContext &context, LogicalOperator &op, idx_t &base_cardinality);
+
+	//! Records the output cardinalities of the operators of a finished query that have a feedback key
+	void RecordQuery(const QueryProfiler::TreeMap &tree_map);
+	//! Looks up the observed selectivity of the relation with the given key
+	bool TryGetSelectivity(const string &key, double &result);
+
+private:
+	mutex lock;
+	//! The observed selectivity of every relation
+	unordered_map<string, double> selectivities;
+};
+
+} // namespace duckdb
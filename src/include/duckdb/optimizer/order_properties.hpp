@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/order_properties.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/planner/bound_result_modifier.hpp"
+#include "duckdb/planner/column_binding.hpp"
+
+namespace duckdb {
+class BoundColumnRefExpression;
+class Expression;
+class LogicalAggregate;
+class LogicalOperator;
+
+//! The order of a single column in the output of a logical operator
+struct OrderedColumn {
+	OrderedColumn(ColumnBinding binding, OrderType type, OrderByNullType null_order)
+	    : binding(binding), type(type), null_order(null_order) {
+	}
+
+	ColumnBinding binding;
+	OrderType type;
+	OrderByNullType null_order;
+};
+
+//! OrderProperties derives the order in which (the physical plan of) a logical operator produces its output
+class OrderProperties {
+public:
+	//! Returns the columns on which the output of the operator is ordered, the most significant column first
+	static vector<OrderedColumn> GetOutputOrder(LogicalOperator &op);
+	//! Whether or not output with the given order is also ordered on the given ORDER BY clause
+	static bool SatisfiesOrder(const vector<OrderedColumn> &order, const vector<BoundOrderByNode> &orders);
+	//! Whether or not the input of the aggregate is ordered on its groups, so it can be computed by streaming
+	static bool CanStreamAggregate(LogicalAggregate &aggr);
+	//! Marks the aggregates in the plan that can be computed by streaming. The order is derived from the column
+	//! bindings, so this has to happen before they are resolved.
+	static void MarkStreamingAggregates(LogicalOperator &op);
+
+private:
+	//! Returns the column that the ORDER BY expression sorts on, or nullptr if it is not a column. This looks through
+	//! the order-preserving compression of integer sort keys by the statistics propagator: CAST((col - min) AS type)
+	static optional_ptr<BoundColumnRefExpression> GetOrderColumn(Expression &expr);
+	static vector<OrderedColumn> GetOrderByOrder(const vector<BoundOrderByNode> &orders);
+	//! Whether or not the leading columns of the order are exactly the given columns (in any order)
+	static bool OrderStartsWithColumns(const vector<OrderedColumn> &order, const vector<ColumnBinding> &columns);
+};
+
+} // namespace duckdb
@@ -8,6 +8,7 @@
 #include "duckdb/optimizer/rule/empty_needle_removal.hpp"
 #include "duckdb/optimizer/rule/like_optimizations.hpp"
 #include "duckdb/optimizer/rule/move_constants.hpp"
+#include "duckdb/optimizer/rule/multi_pattern_contains.hpp"
 #include "duckdb/optimizer/rule/enum_comparison.hpp"
 #include "duckdb/optimizer/rule/regex_optimizations.hpp"
 #include "duckdb/optimizer/rule/ordered_aggregate_optimizer.hpp"
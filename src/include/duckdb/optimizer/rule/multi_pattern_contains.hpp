@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/rule/multi_pattern_contains.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/rule.hpp"
+
+namespace duckdb {
+
+// The MultiPatternContains rule merges disjunctions of contains calls with constant patterns on the same string
+// (e.g. s LIKE '%a%' OR s LIKE '%b%' OR s LIKE '%c%') into a single contains_any call, which searches for all
+// patterns in one pass over the string
+class MultiPatternContainsRule : public Rule {
+public:
+	explicit MultiPatternContainsRule(ExpressionRewriter &rewriter);
+
+	unique_ptr<Expression> Apply(LogicalOperator &op, vector<reference<Expression>> &bindings, bool &changes_made,
+	                             bool is_root) override;
+
+	//! The minimum number of patterns for which we merge the contains calls
+	static constexpr const idx_t MINIMUM_PATTERNS = 3;
+	//! The maximum total size of the patterns, which bounds the size of the automaton
+	static constexpr const idx_t MAXIMUM_PATTERN_SIZE = 4096;
+};
+
+} // namespace duckdb
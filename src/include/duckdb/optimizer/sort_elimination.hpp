@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/sort_elimination.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+
+//! The SortElimination optimizer removes ORDER BY clauses over input that is already sorted on the same keys, and
+//! turns Top-N operators over such input into plain limits
+class SortElimination {
+public:
+	explicit SortElimination(ClientContext &context) : context(context) {
+	}
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	ClientContext &context;
+};
+
+} // namespace duckdb
@@ -134,6 +134,8 @@ private:
 	//! Tries to flush all state from intermediate operators. Will return true if all state is flushed, false in the
 	//! case of a blocked sink.
 	bool TryFlushCachingOperators();
+	//! Flushes the state from intermediate operators into the result chunk when executing a pipeline without a sink
+	void FlushCachingOperatorsPull(DataChunk &result);
 
 	static bool CanCacheType(const LogicalType &type);
 	void CacheChunk(DataChunk &input, idx_t operator_idx);
@@ -38,6 +38,9 @@ public:
 	vector<unsafe_vector<idx_t>> grouping_functions;
 	//! Group statistics (optional)
 	vector<unique_ptr<BaseStatistics>> group_stats;
+	//! Whether or not the input is ordered on the groups, so the aggregate can be computed by streaming. This is set
+	//! by the physical planner before the column bindings are resolved.
+	bool streaming;
 
 public:
 	string ParamsToString() const override;
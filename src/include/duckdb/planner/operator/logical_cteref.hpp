@@ -13,7 +13,7 @@
 
 namespace duckdb {
 
-//! LogicalCTERef represents a reference to a recursive CTE
+//! LogicalCTERef represents a reference to a recursive or materialized CTE
 class LogicalCTERef : public LogicalOperator {
 public:
 	static constexpr const LogicalOperatorType TYPE = LogicalOperatorType::LOGICAL_CTE_REF;
@@ -33,6 +33,8 @@ public:
 	idx_t cte_index;
 	//! The types of the chunk
 	vector<LogicalType> chunk_types;
+	//! Whether or not this references a materialized CTE (rather than the working table of a recursive CTE)
+	bool materialized_cte = false;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
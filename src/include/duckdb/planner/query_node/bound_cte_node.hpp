@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/query_node/bound_cte_node.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+
+namespace duckdb {
+
+//! A BoundCTENode wraps a query node that references a materialized CTE
+class BoundCTENode : public BoundQueryNode {
+public:
+	static constexpr const QueryNodeType TYPE = QueryNodeType::CTE_NODE;
+
+public:
+	BoundCTENode() : BoundQueryNode(QueryNodeType::CTE_NODE) {
+	}
+
+	//! Keep track of the CTE name this node represents
+	string ctename;
+
+	//! The definition of the CTE
+	unique_ptr<BoundQueryNode> query;
+	//! The query node that references the CTE
+	unique_ptr<BoundQueryNode> child;
+
+	//! Index used by the references to the CTE
+	idx_t setop_index;
+	//! The binder used by the CTE definition
+	shared_ptr<Binder> query_binder;
+
+public:
+	idx_t GetRootIndex() override {
+		return child->GetRootIndex();
+	}
+};
+
+} // namespace duckdb
@@ -154,7 +154,7 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 }
 
 PreservedError ClientContext::EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction) {
-	client_data->profiler->EndQuery();
+	client_data->profiler->EndQuery(success);
 
 	if (client_data->http_state) {
 		client_data->http_state->Reset();
@@ -14,6 +14,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 #include <algorithm>
@@ -29,6 +30,10 @@ bool QueryProfiler::IsEnabled() const {
 	return is_explain_analyze ? true : ClientConfig::GetConfig(context).enable_profiler;
 }
 
+bool QueryProfiler::IsCollecting() const {
+	return IsEnabled() || ClientConfig::GetConfig(context).enable_cardinality_feedback;
+}
+
 bool QueryProfiler::IsDetailedEnabled() const {
 	return is_explain_analyze ? false : ClientConfig::GetConfig(context).enable_detailed_profiling;
 }
@@ -53,7 +58,7 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze, bool start
 	if (is_explain_analyze) {
 		StartExplainAnalyze();
 	}
-	if (!IsEnabled()) {
+	if (!IsCollecting()) {
 		return;
 	}
 	if (start_at_optimizer && !PrintOptimizerOutput()) {
@@ -124,15 +129,19 @@ void QueryProfiler::StartExplainAnalyze() {
 	this->is_explain_analyze = true;
 }
 
-void QueryProfiler::EndQuery() {
+void QueryProfiler::EndQuery(bool success) {
 	lock_guard<mutex> guard(flush_lock);
-	if (!IsEnabled() || !running) {
+	if (!IsCollecting() || !running) {
 		return;
 	}
 
 	main_query.End();
 	if (root) {
 		Finalize(*root);
+		auto feedback = CardinalityFeedback::Get(context);
+		if (feedback && success) {
+			feedback->RecordQuery(tree_map);
+		}
 	}
 	this->running = false;
 	// print or output the query profiling after termination
@@ -209,7 +218,7 @@ void QueryProfiler::EndPhase() {
 }
 
 void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
-	if (!IsEnabled() || !running) {
+	if (!IsCollecting() || !running) {
 		return;
 	}
 	this->query_requires_profiling = false;
@@ -291,7 +300,7 @@ void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor
 
 void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	lock_guard<mutex> guard(flush_lock);
-	if (!IsEnabled() || !running) {
+	if (!IsCollecting() || !running) {
 		return;
 	}
 	for (auto &node : profiler.timings) {
@@ -336,6 +336,21 @@ Value DisabledOptimizersSetting::GetSetting(ClientContext &context) {
 	return Value(result);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Cardinality Feedback
+//===--------------------------------------------------------------------===//
+void EnableCardinalityFeedbackSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_cardinality_feedback = input.GetValue<bool>();
+}
+
+void EnableCardinalityFeedbackSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_cardinality_feedback = ClientConfig().enable_cardinality_feedback;
+}
+
+Value EnableCardinalityFeedbackSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_cardinality_feedback);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable External Access
 //===--------------------------------------------------------------------===//
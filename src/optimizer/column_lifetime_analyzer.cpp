@@ -101,6 +101,14 @@ void ColumnLifetimeAnalyzer::VisitOperator(LogicalOperator &op) {
 			analyzer.VisitOperator(*child);
 		}
 		return;
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
+		// the materialized CTE is scanned in its entirety: we can't remove anything from it
+		ColumnLifetimeAnalyzer analyzer(true);
+		analyzer.VisitOperator(*op.children[0]);
+		// the remainder of the query produces the output of this operator
+		VisitOperator(*op.children[1]);
+		return;
+	}
 	case LogicalOperatorType::LOGICAL_PROJECTION: {
 		// then recurse into the children of this projection
 		ColumnLifetimeAnalyzer analyzer;
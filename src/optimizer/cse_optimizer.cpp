@@ -37,6 +37,7 @@ void CommonSubExpressionOptimizer::VisitOperator(LogicalOperator &op) {
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_PROJECTION:
 	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		ExtractFilterSubExpressions(op);
 		ExtractCommonSubExpresions(op);
 		break;
 	default:
@@ -73,6 +74,49 @@ void CommonSubExpressionOptimizer::CountExpressions(Expression &expr, CSEReplace
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CountExpressions(child, state); });
 }
 
+//! Whether or not evaluating the expression always evaluates all of its children for the same rows
+static bool EvaluatesAllChildren(const Expression &expr) {
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_FUNCTION:
+	case ExpressionClass::BOUND_COMPARISON:
+	case ExpressionClass::BOUND_CAST:
+	case ExpressionClass::BOUND_BETWEEN:
+		return true;
+	case ExpressionClass::BOUND_OPERATOR:
+		// COALESCE only evaluates a child for the rows for which all previous children were NULL
+		return expr.type != ExpressionType::OPERATOR_COALESCE;
+	default:
+		// conjunctions and case short-circuit, be conservative for all other expressions
+		return false;
+	}
+}
+
+void CommonSubExpressionOptimizer::CountUnconditionalExpressions(Expression &expr, CSEReplacementState &state) {
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+	case ExpressionClass::BOUND_CONSTANT:
+	case ExpressionClass::BOUND_PARAMETER:
+	case ExpressionClass::BOUND_CONJUNCTION:
+	case ExpressionClass::BOUND_CASE:
+		return;
+	default:
+		break;
+	}
+	if (expr.expression_class != ExpressionClass::BOUND_AGGREGATE && !expr.HasSideEffects()) {
+		auto node = state.expression_count.find(expr);
+		if (node == state.expression_count.end()) {
+			state.expression_count[expr] = CSENode();
+		} else {
+			node->second.count++;
+		}
+	}
+	if (!EvaluatesAllChildren(expr)) {
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr,
+	                                      [&](Expression &child) { CountUnconditionalExpressions(child, state); });
+}
+
 void CommonSubExpressionOptimizer::PerformCSEReplacement(unique_ptr<Expression> &expr_ptr, CSEReplacementState &state) {
 	Expression &expr = *expr_ptr;
 	if (expr.expression_class == ExpressionClass::BOUND_COLUMN_REF) {
@@ -153,4 +197,58 @@ void CommonSubExpressionOptimizer::ExtractCommonSubExpresions(LogicalOperator &o
 	op.children[0] = std::move(projection);
 }
 
+void CommonSubExpressionOptimizer::ExtractFilterSubExpressions(LogicalOperator &op) {
+	D_ASSERT(op.children.size() == 1);
+	if (op.children[0]->type != LogicalOperatorType::LOGICAL_FILTER) {
+		return;
+	}
+	auto &filter = op.children[0]->Cast<LogicalFilter>();
+	if (!filter.projection_map.empty()) {
+		// the filter projects out columns of its child by index, we cannot change the child
+		return;
+	}
+	if (filter.expressions.size() != 1) {
+		// the conjuncts of a filter are evaluated one after another on the rows that passed the previous conjuncts
+		// only the expressions of a single condition are guaranteed to be evaluated for every row
+		return;
+	}
+	// count the expressions of the filter and the expressions of the operator on top of it separately
+	// only the expressions the filter evaluates for every row can be moved into a projection below the filter,
+	// otherwise we would evaluate (and possibly throw an error for) rows that a branch was never evaluated for
+	CSEReplacementState filter_state;
+	for (auto &expr : filter.expressions) {
+		CountUnconditionalExpressions(*expr, filter_state);
+	}
+	CSEReplacementState op_state;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { CountExpressions(**child, op_state); });
+
+	// the filter evaluates these expressions for every row
+	// if the operator on top of the filter computes the same expression again, we compute it only once in a
+	// projection below the filter, and reference the result in both operators
+	CSEReplacementState state;
+	for (auto &entry : filter_state.expression_count) {
+		if (op_state.expression_count.find(entry.first) == op_state.expression_count.end()) {
+			continue;
+		}
+		CSENode node;
+		node.count = entry.second.count + op_state.expression_count[entry.first].count;
+		state.expression_count[entry.first] = node;
+	}
+	if (state.expression_count.empty()) {
+		// no expressions are shared between the filter and the operator
+		return;
+	}
+	state.projection_index = binder.GenerateTableIndex();
+	for (auto &expr : filter.expressions) {
+		PerformCSEReplacement(expr, state);
+	}
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { PerformCSEReplacement(*child, state); });
+
+	auto projection = make_uniq<LogicalProjection>(state.projection_index, std::move(state.expressions));
+	projection->children.push_back(std::move(filter.children[0]));
+	filter.children[0] = std::move(projection);
+}
+
 } // namespace duckdb
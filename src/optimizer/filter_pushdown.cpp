@@ -38,6 +38,13 @@ unique_ptr<LogicalOperator> FilterPushdown::Rewrite(unique_ptr<LogicalOperator>
 		op->children[0] = Rewrite(std::move(op->children[0]));
 		return op;
 	}
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
+		// the CTE is shared by all its references: filters can only be pushed into the remainder of the query
+		FilterPushdown pushdown(optimizer);
+		op->children[0] = pushdown.Rewrite(std::move(op->children[0]));
+		op->children[1] = Rewrite(std::move(op->children[1]));
+		return op;
+	}
 	case LogicalOperatorType::LOGICAL_GET:
 		return PushdownGet(std::move(op));
 	case LogicalOperatorType::LOGICAL_LIMIT:
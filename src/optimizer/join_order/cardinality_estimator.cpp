@@ -1,4 +1,5 @@
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
@@ -365,6 +366,18 @@ bool SortTdoms(const RelationsToTDom &a, const RelationsToTDom &b) {
 	return a.tdom_no_hll > b.tdom_no_hll;
 }
 
+void CardinalityEstimator::InitFeedbackKeys(vector<unique_ptr<SingleJoinRelation>> &relations) {
+	feedback = CardinalityFeedback::Get(context);
+	if (!feedback) {
+		return;
+	}
+	feedback_keys.resize(relations.size());
+	feedback_base_cardinalities.resize(relations.size(), 0);
+	for (idx_t i = 0; i < relations.size(); i++) {
+		feedback_keys[i] = CardinalityFeedback::GetRelationKey(context, relations[i]->op, feedback_base_cardinalities[i]);
+	}
+}
+
 void CardinalityEstimator::InitCardinalityEstimatorProps(vector<NodeOp> &node_ops,
                                                          vector<unique_ptr<FilterInfo>> &filter_infos) {
 	InitEquivalentRelations(filter_infos);
@@ -569,10 +582,29 @@ idx_t CardinalityEstimator::InspectTableFilters(idx_t cardinality, LogicalOperat
 	return cardinality_after_filters;
 }
 
+bool CardinalityEstimator::TryGetFeedbackCardinality(idx_t relation_id, double &result) {
+	if (!feedback || relation_id >= feedback_keys.size()) {
+		return false;
+	}
+	auto &key = feedback_keys[relation_id];
+	double selectivity;
+	if (key.empty() || !feedback->TryGetSelectivity(key, selectivity)) {
+		return false;
+	}
+	result = MaxValue<double>(double(feedback_base_cardinalities[relation_id]) * selectivity, 1);
+	return true;
+}
+
 void CardinalityEstimator::EstimateBaseTableCardinality(JoinNode &node, LogicalOperator &op) {
 	auto has_logical_filter = IsLogicalFilter(op);
 	D_ASSERT(node.set.count == 1);
 	auto relation_id = node.set.relations[0];
+	double feedback_cardinality;
+	if (TryGetFeedbackCardinality(relation_id, feedback_cardinality)) {
+		// we have observed the cardinality of this relation before: use it instead of estimating the filters
+		node.SetEstimatedCardinality(feedback_cardinality);
+		return;
+	}
 
 	double lowest_card_found = node.GetBaseTableCardinality();
 	for (auto &column : relation_attributes[relation_id].columns) {
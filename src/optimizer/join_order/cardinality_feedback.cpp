@@ -0,0 +1,100 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+bool CardinalityFeedback::IsEnabled(ClientContext &context) {
+	return ClientConfig::GetConfig(context).enable_cardinality_feedback;
+}
+
+shared_ptr<CardinalityFeedback> CardinalityFeedback::Get(ClientContext &context) {
+	if (!IsEnabled(context)) {
+		return nullptr;
+	}
+	return ObjectCache::GetObjectCache(context).GetOrCreate<CardinalityFeedback>(ObjectType());
+}
+
+string CardinalityFeedback::GetRelationKey(ClientContext &context, LogicalOperator &op, idx_t &base_cardinality) {
+	vector<string> predicates;
+	reference<LogicalOperator> current(op);
+	while (current.get().type == LogicalOperatorType::LOGICAL_FILTER) {
+		for (auto &expr : current.get().expressions) {
+			if (expr->HasParameter()) {
+				// the selectivity depends on the parameter values
+				return string();
+			}
+			predicates.push_back(expr->ToString());
+		}
+		current = *current.get().children[0];
+	}
+	if (current.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return string();
+	}
+	auto &get = current.get().Cast<LogicalGet>();
+	auto table = get.GetTable();
+	if (!table) {
+		return string();
+	}
+	for (auto &entry : get.table_filters.filters) {
+		if (entry.first >= get.names.size()) {
+			return string();
+		}
+		predicates.push_back(entry.second->ToString(get.names[entry.first]));
+	}
+	if (predicates.empty()) {
+		// the cardinality of an unfiltered scan is known up front
+		return string();
+	}
+	// the order in which the filters are applied does not matter
+	std::sort(predicates.begin(), predicates.end());
+
+	string key = table->ParentCatalog().GetName() + "." + table->ParentSchema().name + "." + table->name;
+	for (auto &predicate : predicates) {
+		key += "\n" + predicate;
+	}
+	base_cardinality = get.EstimateCardinality(context);
+	return key;
+}
+
+void CardinalityFeedback::RecordQuery(const QueryProfiler::TreeMap &tree_map) {
+	for (auto &entry : tree_map) {
+		switch (entry.first.get().type) {
+		case PhysicalOperatorType::LIMIT:
+		case PhysicalOperatorType::STREAMING_LIMIT:
+			// a limit stops the scans early, so the observed cardinalities are incomplete
+			return;
+		default:
+			break;
+		}
+	}
+	lock_guard<mutex> guard(lock);
+	for (auto &entry : tree_map) {
+		auto &op = entry.first.get();
+		if (op.feedback_key.empty() || op.feedback_base_cardinality == 0) {
+			continue;
+		}
+		if (selectivities.size() >= MAXIMUM_ENTRIES && selectivities.find(op.feedback_key) == selectivities.end()) {
+			continue;
+		}
+		auto observed_cardinality = double(entry.second.get().info.elements);
+		auto selectivity = observed_cardinality / double(op.feedback_base_cardinality);
+		selectivities[op.feedback_key] = MinValue<double>(selectivity, 1);
+	}
+}
+
+bool CardinalityFeedback::TryGetSelectivity(const string &key, double &result) {
+	lock_guard<mutex> guard(lock);
+	auto entry = selectivities.find(key);
+	if (entry == selectivities.end()) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
+} // namespace duckdb
@@ -113,7 +113,8 @@ bool JoinOrderOptimizer::ExtractJoinRelations(LogicalOperator &input_op,
 	bool non_reorderable_operation = false;
 	if (op->type == LogicalOperatorType::LOGICAL_UNION || op->type == LogicalOperatorType::LOGICAL_EXCEPT ||
 	    op->type == LogicalOperatorType::LOGICAL_INTERSECT || op->type == LogicalOperatorType::LOGICAL_DELIM_JOIN ||
-	    op->type == LogicalOperatorType::LOGICAL_ANY_JOIN || op->type == LogicalOperatorType::LOGICAL_ASOF_JOIN) {
+	    op->type == LogicalOperatorType::LOGICAL_ANY_JOIN || op->type == LogicalOperatorType::LOGICAL_ASOF_JOIN ||
+	    op->type == LogicalOperatorType::LOGICAL_MATERIALIZED_CTE) {
 		// set operation, optimize separately in children
 		non_reorderable_operation = true;
 	}
@@ -221,6 +222,18 @@ bool JoinOrderOptimizer::ExtractJoinRelations(LogicalOperator &input_op,
 		relations.push_back(std::move(relation));
 		return true;
 	}
+	case LogicalOperatorType::LOGICAL_CTE_REF: {
+		auto &cte_ref = op->Cast<LogicalCTERef>();
+		if (!cte_ref.materialized_cte) {
+			// the working table of a recursive CTE changes in every iteration: don't reorder around it
+			return false;
+		}
+		// scan of a materialized CTE, add to set of relations
+		auto relation = make_uniq<SingleJoinRelation>(input_op, parent);
+		relation_mapping[cte_ref.table_index] = relations.size();
+		relations.push_back(std::move(relation));
+		return true;
+	}
 	case LogicalOperatorType::LOGICAL_GET:
 	case LogicalOperatorType::LOGICAL_PROJECTION: {
 		auto table_index = op->GetTableIndex()[0];
@@ -966,6 +979,8 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOpera
 		// at most one relation, nothing to reorder
 		return plan;
 	}
+	// the cardinality feedback is keyed on the filters of each relation, so look it up before extracting them
+	cardinality_estimator.InitFeedbackKeys(relations);
 	// now that we know we are going to perform join ordering we actually extract the filters, eliminating duplicate
 	// filters in the process
 	expression_set_t filter_set;
@@ -0,0 +1,179 @@
+#include "duckdb/optimizer/order_properties.hpp"
+
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+optional_ptr<BoundColumnRefExpression> OrderProperties::GetOrderColumn(Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		return &expr.Cast<BoundColumnRefExpression>();
+	}
+	if (expr.type != ExpressionType::OPERATOR_CAST) {
+		return nullptr;
+	}
+	// the value is within [min, max], so subtracting the minimum and casting to an unsigned type preserves the order
+	auto &cast = expr.Cast<BoundCastExpression>();
+	switch (cast.return_type.id()) {
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+		break;
+	default:
+		return nullptr;
+	}
+	if (cast.child->type != ExpressionType::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func = cast.child->Cast<BoundFunctionExpression>();
+	if (func.function.name != "-" || func.children.size() != 2 ||
+	    func.children[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+	    func.children[1]->type != ExpressionType::VALUE_CONSTANT) {
+		return nullptr;
+	}
+	return &func.children[0]->Cast<BoundColumnRefExpression>();
+}
+
+vector<OrderedColumn> OrderProperties::GetOrderByOrder(const vector<BoundOrderByNode> &orders) {
+	vector<OrderedColumn> result;
+	for (auto &order : orders) {
+		auto colref = GetOrderColumn(*order.expression);
+		if (!colref) {
+			// the output is only ordered on the columns up until the first expression
+			break;
+		}
+		result.emplace_back(colref->binding, order.type, order.null_order);
+	}
+	return result;
+}
+
+vector<OrderedColumn> OrderProperties::GetOutputOrder(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+		return GetOrderByOrder(op.Cast<LogicalOrder>().orders);
+	case LogicalOperatorType::LOGICAL_TOP_N:
+		return GetOrderByOrder(op.Cast<LogicalTopN>().orders);
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_LIMIT:
+		// these operators preserve the order of their input
+		return GetOutputOrder(*op.children[0]);
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		auto child_order = GetOutputOrder(*op.children[0]);
+		vector<OrderedColumn> result;
+		for (auto &column : child_order) {
+			// find the ordered column in the projection list
+			idx_t column_index = DConstants::INVALID_INDEX;
+			for (idx_t i = 0; i < proj.expressions.size(); i++) {
+				auto &expr = *proj.expressions[i];
+				if (expr.type == ExpressionType::BOUND_COLUMN_REF &&
+				    expr.Cast<BoundColumnRefExpression>().binding == column.binding) {
+					column_index = i;
+					break;
+				}
+			}
+			if (column_index == DConstants::INVALID_INDEX) {
+				// the column is projected out: the output is only ordered on the preceding columns
+				break;
+			}
+			result.emplace_back(ColumnBinding(proj.table_index, column_index), column.type, column.null_order);
+		}
+		return result;
+	}
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		auto &aggr = op.Cast<LogicalAggregate>();
+		if (!CanStreamAggregate(aggr)) {
+			return vector<OrderedColumn>();
+		}
+		// a streaming aggregate emits the groups in the order of its input
+		auto child_order = GetOutputOrder(*op.children[0]);
+		vector<OrderedColumn> result;
+		for (idx_t i = 0; i < aggr.groups.size(); i++) {
+			auto &column = child_order[i];
+			for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+				auto &group = aggr.groups[group_idx]->Cast<BoundColumnRefExpression>();
+				if (group.binding == column.binding) {
+					result.emplace_back(ColumnBinding(aggr.group_index, group_idx), column.type, column.null_order);
+					break;
+				}
+			}
+		}
+		return result;
+	}
+	default:
+		return vector<OrderedColumn>();
+	}
+}
+
+bool OrderProperties::SatisfiesOrder(const vector<OrderedColumn> &order, const vector<BoundOrderByNode> &orders) {
+	if (orders.size() > order.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto colref = GetOrderColumn(*orders[i].expression);
+		if (!colref) {
+			return false;
+		}
+		if (!(colref->binding == order[i].binding) || orders[i].type != order[i].type ||
+		    orders[i].null_order != order[i].null_order) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool OrderProperties::OrderStartsWithColumns(const vector<OrderedColumn> &order, const vector<ColumnBinding> &columns) {
+	if (order.size() < columns.size()) {
+		return false;
+	}
+	column_binding_set_t column_set(columns.begin(), columns.end());
+	column_binding_set_t order_set;
+	for (idx_t i = 0; i < columns.size(); i++) {
+		if (column_set.find(order[i].binding) == column_set.end()) {
+			return false;
+		}
+		order_set.insert(order[i].binding);
+	}
+	return order_set.size() == column_set.size();
+}
+
+bool OrderProperties::CanStreamAggregate(LogicalAggregate &aggr) {
+	if (aggr.groups.empty() || aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		return false;
+	}
+	if (aggr.grouping_sets.size() == 1 && aggr.grouping_sets[0].size() != aggr.groups.size()) {
+		return false;
+	}
+	if (!PhysicalStreamingAggregate::CanStreamAggregates(aggr.expressions)) {
+		return false;
+	}
+	vector<ColumnBinding> group_bindings;
+	for (auto &group : aggr.groups) {
+		if (group->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		group_bindings.push_back(group->Cast<BoundColumnRefExpression>().binding);
+	}
+	// all rows of a group are adjacent if the input is ordered on (exactly) the groups first
+	return OrderStartsWithColumns(GetOutputOrder(*aggr.children[0]), group_bindings);
+}
+
+void OrderProperties::MarkStreamingAggregates(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		auto &aggr = op.Cast<LogicalAggregate>();
+		aggr.streaming = CanStreamAggregate(aggr);
+	}
+	for (auto &child : op.children) {
+		MarkStreamingAggregates(*child);
+	}
+}
+
+} // namespace duckdb
@@ -164,6 +164,14 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 			remove.VisitOperator(*child);
 		}
 		return;
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
+		// the materialized CTE is scanned in its entirety: we can't remove anything from it
+		RemoveUnusedColumns remove(binder, context, true);
+		remove.VisitOperator(*op.children[0]);
+		// the remainder of the query produces the output of this operator
+		VisitOperator(*op.children[1]);
+		return;
+	}
 	case LogicalOperatorType::LOGICAL_ORDER_BY:
 		if (!everything_referenced) {
 			auto &order = op.Cast<LogicalOrder>();
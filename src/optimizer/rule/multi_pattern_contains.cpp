@@ -0,0 +1,128 @@
+#include "duckdb/optimizer/rule/multi_pattern_contains.hpp"
+
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar/string_functions.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+MultiPatternContainsRule::MultiPatternContainsRule(ExpressionRewriter &rewriter) : Rule(rewriter) {
+	// match on an OR that has at least one contains or contains_any call as child
+	auto op = make_uniq<ConjunctionExpressionMatcher>();
+	op->expr_type = make_uniq<SpecificExpressionTypeMatcher>(ExpressionType::CONJUNCTION_OR);
+	auto func = make_uniq<FunctionExpressionMatcher>();
+	func->function = make_uniq<ManyFunctionMatcher>(unordered_set<string> {"contains", "contains_any"});
+	func->policy = SetMatcher::Policy::SOME;
+	op->matchers.push_back(std::move(func));
+	op->policy = SetMatcher::Policy::SOME;
+	root = std::move(op);
+}
+
+struct ContainsGroup {
+	explicit ContainsGroup(Expression &haystack) : haystack(haystack), pattern_size(0) {
+	}
+
+	//! The string that is searched
+	Expression &haystack;
+	//! The children of the OR that search the string
+	vector<idx_t> child_indexes;
+	//! The patterns that are searched for
+	vector<Value> patterns;
+	//! The total size of the patterns
+	idx_t pattern_size;
+};
+
+//! Adds the patterns of a contains or contains_any call to the list, returns false if the call cannot be merged
+static bool GetPatterns(ClientContext &context, BoundFunctionExpression &func, vector<Value> &patterns) {
+	if (func.children.size() != 2 || func.children[0]->return_type != LogicalType::VARCHAR ||
+	    func.children[0]->HasSideEffects() || !func.children[1]->IsFoldable()) {
+		return false;
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, *func.children[1]);
+	if (value.IsNull()) {
+		return false;
+	}
+	if (func.function.name == "contains") {
+		if (value.type() != LogicalType::VARCHAR) {
+			return false;
+		}
+		patterns.push_back(std::move(value));
+		return true;
+	}
+	for (auto &pattern : ListValue::GetChildren(value)) {
+		patterns.push_back(pattern);
+	}
+	return true;
+}
+
+unique_ptr<Expression> MultiPatternContainsRule::Apply(LogicalOperator &op, vector<reference<Expression>> &bindings,
+                                                       bool &changes_made, bool is_root) {
+	auto &conjunction = bindings[0].get().Cast<BoundConjunctionExpression>();
+
+	// group the contains calls on the children of the OR by the string they search
+	vector<ContainsGroup> groups;
+	for (idx_t child_idx = 0; child_idx < conjunction.children.size(); child_idx++) {
+		auto &child = *conjunction.children[child_idx];
+		if (child.expression_class != ExpressionClass::BOUND_FUNCTION) {
+			continue;
+		}
+		auto &func = child.Cast<BoundFunctionExpression>();
+		if (func.function.name != "contains" && func.function.name != "contains_any") {
+			continue;
+		}
+		vector<Value> patterns;
+		if (!GetPatterns(GetContext(), func, patterns)) {
+			continue;
+		}
+		auto &haystack = *func.children[0];
+		idx_t group_idx;
+		for (group_idx = 0; group_idx < groups.size(); group_idx++) {
+			if (groups[group_idx].haystack.Equals(haystack)) {
+				break;
+			}
+		}
+		if (group_idx == groups.size()) {
+			groups.emplace_back(haystack);
+		}
+		auto &group = groups[group_idx];
+		group.child_indexes.push_back(child_idx);
+		for (auto &pattern : patterns) {
+			group.pattern_size += StringValue::Get(pattern).size();
+			group.patterns.push_back(std::move(pattern));
+		}
+	}
+
+	// replace the contains calls of every group with enough patterns by a single contains_any call
+	vector<idx_t> removed_children;
+	for (auto &group : groups) {
+		if (group.child_indexes.size() < 2 || group.patterns.size() < MINIMUM_PATTERNS ||
+		    group.pattern_size > MAXIMUM_PATTERN_SIZE) {
+			continue;
+		}
+		vector<unique_ptr<Expression>> children;
+		children.push_back(group.haystack.Copy());
+		children.push_back(make_uniq<BoundConstantExpression>(Value::LIST(LogicalType::VARCHAR, group.patterns)));
+		auto function = ContainsAnyFun::GetFunction();
+		auto bind_info = function.bind(GetContext(), function, children);
+		auto contains_any = make_uniq<BoundFunctionExpression>(LogicalType::BOOLEAN, std::move(function),
+		                                                       std::move(children), std::move(bind_info));
+		conjunction.children[group.child_indexes[0]] = std::move(contains_any);
+		removed_children.insert(removed_children.end(), group.child_indexes.begin() + 1, group.child_indexes.end());
+	}
+	if (removed_children.empty()) {
+		return nullptr;
+	}
+	std::sort(removed_children.begin(), removed_children.end());
+	for (idx_t i = removed_children.size(); i > 0; i--) {
+		conjunction.children.erase(conjunction.children.begin() + removed_children[i - 1]);
+	}
+	if (conjunction.children.size() == 1) {
+		return std::move(conjunction.children[0]);
+	}
+	changes_made = true;
+	return nullptr;
+}
+
+} // namespace duckdb
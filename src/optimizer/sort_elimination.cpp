@@ -0,0 +1,44 @@
+#include "duckdb/optimizer/sort_elimination.hpp"
+
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/order_properties.hpp"
+#include "duckdb/planner/operator/logical_limit.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+unique_ptr<LogicalOperator> SortElimination::Optimize(unique_ptr<LogicalOperator> op) {
+	if (!DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		// the order of the input is only known to be preserved if insertion order is preserved
+		return op;
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	switch (op->type) {
+	case LogicalOperatorType::LOGICAL_ORDER_BY: {
+		auto &order = op->Cast<LogicalOrder>();
+		if (OrderProperties::SatisfiesOrder(OrderProperties::GetOutputOrder(*op->children[0]), order.orders)) {
+			// the input is already sorted on the keys: the ORDER BY can be removed
+			return std::move(op->children[0]);
+		}
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_TOP_N: {
+		auto &top_n = op->Cast<LogicalTopN>();
+		if (OrderProperties::SatisfiesOrder(OrderProperties::GetOutputOrder(*op->children[0]), top_n.orders)) {
+			// the input is already sorted on the keys: we only need to limit it
+			auto limit = make_uniq<LogicalLimit>(top_n.limit, top_n.offset, nullptr, nullptr);
+			limit->AddChild(std::move(op->children[0]));
+			return std::move(limit);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	return op;
+}
+
+} // namespace duckdb
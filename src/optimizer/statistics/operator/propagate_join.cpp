@@ -126,9 +126,9 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			auto stats_left = PropagateExpression(condition.left);
 			auto stats_right = PropagateExpression(condition.right);
 			// Update join_stats when is already part of the join
-			if (join.join_stats.size() == 2) {
-				join.join_stats[0] = std::move(stats_left);
-				join.join_stats[1] = std::move(stats_right);
+			if (join.join_stats.size() == 2 * (i + 1)) {
+				join.join_stats[2 * i] = std::move(stats_left);
+				join.join_stats[2 * i + 1] = std::move(stats_right);
 			}
 			break;
 		}
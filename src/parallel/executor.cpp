@@ -162,7 +162,12 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 			auto dep = dependency.lock();
 			D_ASSERT(dep);
 			auto event_map_entry = event_map.find(*dep);
-			D_ASSERT(event_map_entry != event_map.end());
+			if (event_map_entry == event_map.end()) {
+				// when rescheduling the pipelines of a recursive CTE, pipelines outside of the recursion (e.g. the
+				// materialization of a CTE that is scanned in the recursion) have already finished
+				D_ASSERT(!event_data.initial_schedule);
+				continue;
+			}
 			auto &dep_entry = event_map_entry->second;
 			entry.second.pipeline_event.AddDependency(dep_entry.pipeline_complete_event);
 		}
@@ -302,6 +302,9 @@ void PipelineExecutor::ExecutePull(DataChunk &result) {
 				}
 			}
 		}
+		if (result.size() == 0 && exhausted_source && (started_flushing || in_process_operators.empty())) {
+			FlushCachingOperatorsPull(result);
+		}
 	} catch (const Exception &ex) { // LCOV_EXCL_START
 		if (executor.HasError()) {
 			executor.ThrowException();
@@ -320,6 +323,41 @@ void PipelineExecutor::ExecutePull(DataChunk &result) {
 	} // LCOV_EXCL_STOP
 }
 
+void PipelineExecutor::FlushCachingOperatorsPull(DataChunk &result) {
+	if (!started_flushing) {
+		started_flushing = true;
+		flushing_idx = 0;
+	}
+	// Go over each operator and flush them using `FinalExecute` until we have a result chunk
+	while (result.size() == 0 && flushing_idx < pipeline.operators.size()) {
+		auto &current_operator = pipeline.operators[flushing_idx].get();
+		bool last_operator = flushing_idx + 1 >= pipeline.operators.size();
+		auto &curr_chunk = last_operator ? result : *intermediate_chunks[flushing_idx + 1];
+		OperatorResultType push_result = OperatorResultType::NEED_MORE_INPUT;
+		if (!in_process_operators.empty()) {
+			// the operators following the flushed operator have output remaining
+			push_result = Execute(curr_chunk, result, flushing_idx + 1);
+		} else if (!current_operator.RequiresFinalExecute() || !should_flush_current_idx) {
+			flushing_idx++;
+			should_flush_current_idx = true;
+			continue;
+		} else {
+			curr_chunk.Reset();
+			StartOperator(current_operator);
+			auto finalize_result = current_operator.FinalExecute(context, curr_chunk, *current_operator.op_state,
+			                                                     *intermediate_states[flushing_idx]);
+			EndOperator(current_operator, &curr_chunk);
+			should_flush_current_idx = finalize_result == OperatorFinalizeResultType::HAVE_MORE_OUTPUT;
+			if (!last_operator) {
+				push_result = Execute(curr_chunk, result, flushing_idx + 1);
+			}
+		}
+		if (push_result == OperatorResultType::FINISHED) {
+			flushing_idx = pipeline.operators.size();
+		}
+	}
+}
+
 void PipelineExecutor::PullFinalize() {
 	if (finalized) {
 		throw InternalException("Calling PullFinalize on a pipeline that has been finalized already");
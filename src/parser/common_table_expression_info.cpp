@@ -7,12 +7,14 @@ namespace duckdb {
 void CommonTableExpressionInfo::FormatSerialize(FormatSerializer &serializer) const {
 	serializer.WriteProperty("aliases", aliases);
 	serializer.WriteProperty("query", query);
+	serializer.WriteProperty("materialized", materialized);
 }
 
 unique_ptr<CommonTableExpressionInfo> CommonTableExpressionInfo::FormatDeserialize(FormatDeserializer &deserializer) {
 	auto result = make_uniq<CommonTableExpressionInfo>();
 	result->aliases = deserializer.ReadProperty<vector<string>>("aliases");
 	result->query = deserializer.ReadProperty<unique_ptr<SelectStatement>>("query");
+	result->materialized = deserializer.ReadProperty<CTEMaterialize>("materialized");
 	return result;
 }
 
@@ -59,7 +59,13 @@ string CommonTableExpressionMap::ToString() const {
 			}
 			result += ")";
 		}
-		result += " AS (";
+		if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_ALWAYS) {
+			result += " AS MATERIALIZED (";
+		} else if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_NEVER) {
+			result += " AS NOT MATERIALIZED (";
+		} else {
+			result += " AS (";
+		}
 		result += cte.query->ToString();
 		result += ")";
 		first_cte = false;
@@ -142,6 +148,9 @@ bool QueryNode::Equals(const QueryNode *other) const {
 		if (entry.second->aliases != other_entry->second->aliases) {
 			return false;
 		}
+		if (entry.second->materialized != other_entry->second->materialized) {
+			return false;
+		}
 		if (!entry.second->query->Equals(*other_entry->second->query)) {
 			return false;
 		}
@@ -159,6 +168,7 @@ void QueryNode::CopyProperties(QueryNode &other) const {
 			kv_info->aliases.push_back(al);
 		}
 		kv_info->query = unique_ptr_cast<SQLStatement, SelectStatement>(kv.second->query->Copy());
+		kv_info->materialized = kv.second->materialized;
 		other.cte_map.map[kv.first] = std::move(kv_info);
 	}
 }
@@ -171,12 +181,16 @@ void QueryNode::Serialize(Serializer &main_serializer) const {
 
 	writer.WriteField<uint32_t>((uint32_t)cte_map.map.size());
 	auto &serializer = writer.GetSerializer();
+	vector<CTEMaterialize> materialized;
 	for (auto &cte : cte_map.map) {
 		serializer.WriteString(cte.first);
 		serializer.WriteStringVector(cte.second->aliases);
 		cte.second->query->Serialize(serializer);
+		materialized.push_back(cte.second->materialized);
 	}
 	Serialize(writer);
+	// the materialization of the CTEs (in the order they were written above)
+	writer.WriteList<CTEMaterialize>(materialized);
 
 	writer.Finalize();
 }
@@ -226,11 +240,13 @@ unique_ptr<QueryNode> QueryNode::Deserialize(Deserializer &main_source) {
 	auto cte_count = reader.ReadRequired<uint32_t>();
 	auto &source = reader.GetSource();
 	case_insensitive_map_t<unique_ptr<CommonTableExpressionInfo>> new_map;
+	vector<string> cte_names;
 	for (idx_t i = 0; i < cte_count; i++) {
 		auto name = source.Read<string>();
 		auto info = make_uniq<CommonTableExpressionInfo>();
 		source.ReadStringVector(info->aliases);
 		info->query = SelectStatement::Deserialize(source);
+		cte_names.push_back(name);
 		new_map[name] = std::move(info);
 	}
 	unique_ptr<QueryNode> result;
@@ -247,6 +263,13 @@ unique_ptr<QueryNode> QueryNode::Deserialize(Deserializer &main_source) {
 	default:
 		throw SerializationException("Could not deserialize Query Node: unknown type!");
 	}
+	vector<CTEMaterialize> materialized;
+	if (reader.ReadList<CTEMaterialize>(materialized)) {
+		D_ASSERT(materialized.size() == cte_names.size());
+		for (idx_t i = 0; i < cte_names.size(); i++) {
+			new_map[cte_names[i]]->materialized = materialized[i];
+		}
+	}
 	result->modifiers = std::move(modifiers);
 	result->cte_map.map = std::move(new_map);
 	reader.Finalize();
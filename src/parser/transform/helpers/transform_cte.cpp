@@ -10,9 +10,22 @@ unique_ptr<CommonTableExpressionInfo> CommonTableExpressionInfo::Copy() {
 	auto result = make_uniq<CommonTableExpressionInfo>();
 	result->aliases = aliases;
 	result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
+	result->materialized = materialized;
 	return result;
 }
 
+static CTEMaterialize TransformMaterializationType(duckdb_libpgquery::PGCTEMaterialize materialize) {
+	switch (materialize) {
+	case duckdb_libpgquery::PGCTEMaterializeAlways:
+		return CTEMaterialize::CTE_MATERIALIZE_ALWAYS;
+	case duckdb_libpgquery::PGCTEMaterializeNever:
+		return CTEMaterialize::CTE_MATERIALIZE_NEVER;
+	case duckdb_libpgquery::PGCTEMaterializeDefault:
+	default:
+		return CTEMaterialize::CTE_MATERIALIZE_DEFAULT;
+	}
+}
+
 void Transformer::ExtractCTEsRecursive(CommonTableExpressionMap &cte_map) {
 	for (auto &cte_entry : stored_cte_map) {
 		for (auto &entry : cte_entry->map) {
@@ -72,6 +85,7 @@ void Transformer::TransformCTE(duckdb_libpgquery::PGWithClause &de_with_clause,
 			    cte_transformer.TransformSelect(*PGPointerCast<duckdb_libpgquery::PGSelectStmt>(cte.ctequery));
 		}
 		D_ASSERT(info->query);
+		info->materialized = TransformMaterializationType(cte.ctematerialized);
 		auto cte_name = string(cte.ctename);
 
 		auto it = cte_map.map.find(cte_name);
@@ -102,12 +102,16 @@ BoundStatement Binder::Bind(SQLStatement &statement) {
 void Binder::AddCTEMap(CommonTableExpressionMap &cte_map) {
 	for (auto &cte_it : cte_map.map) {
 		AddCTE(cte_it.first, *cte_it.second);
+		// the CTE shadows any materialized CTE with the same name that was inherited from a parent binder
+		bind_context.RemoveCTEBinding(cte_it.first);
 	}
 }
 
 unique_ptr<BoundQueryNode> Binder::BindNode(QueryNode &node) {
 	// first we visit the set of CTEs and add them to the bind context
 	AddCTEMap(node.cte_map);
+	// bind the CTEs that are materialized, their references scan the materialized result
+	auto materialized_ctes = BindMaterializedCTEs(node);
 	// now we bind the node
 	unique_ptr<BoundQueryNode> result;
 	switch (node.type) {
@@ -122,6 +126,19 @@ unique_ptr<BoundQueryNode> Binder::BindNode(QueryNode &node) {
 		result = BindNode(node.Cast<SetOperationNode>());
 		break;
 	}
+	// wrap the node in the materialized CTEs, in reverse order so that the CTEs are computed in dependency order
+	for (idx_t i = materialized_ctes.size(); i > 0; i--) {
+		auto &cte = materialized_ctes[i - 1];
+		auto cte_references = bind_context.cte_references[cte->ctename];
+		if (!cte_references || *cte_references == 0) {
+			// the CTE ended up not being referenced (e.g. because it was shadowed): skip it
+			continue;
+		}
+		cte->names = result->names;
+		cte->types = result->types;
+		cte->child = std::move(result);
+		result = std::move(cte);
+	}
 	return result;
 }
 
@@ -145,6 +162,8 @@ unique_ptr<LogicalOperator> Binder::CreatePlan(BoundQueryNode &node) {
 		return CreatePlan(node.Cast<BoundSetOperationNode>());
 	case QueryNodeType::RECURSIVE_CTE_NODE:
 		return CreatePlan(node.Cast<BoundRecursiveCTENode>());
+	case QueryNodeType::CTE_NODE:
+		return CreatePlan(node.Cast<BoundCTENode>());
 	default:
 		throw InternalException("Unsupported bound query node type");
 	}
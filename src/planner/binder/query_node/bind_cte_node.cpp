@@ -0,0 +1,225 @@
+#include "duckdb/common/exception.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/query_node/recursive_cte_node.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/parser/tableref/joinref.hpp"
+#include "duckdb/parser/tableref/pivotref.hpp"
+#include "duckdb/parser/tableref/subqueryref.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/query_node/bound_cte_node.hpp"
+
+namespace duckdb {
+
+static void CountCTEReferences(QueryNode &node, const string &name, idx_t &count);
+
+static void CountCTEReferences(ParsedExpression &expr, const string &name, idx_t &count) {
+	if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+		auto &subquery = expr.Cast<SubqueryExpression>();
+		CountCTEReferences(*subquery.subquery->node, name, count);
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { CountCTEReferences(child, name, count); });
+}
+
+static void CountCTEReferences(TableRef &ref, const string &name, idx_t &count) {
+	switch (ref.type) {
+	case TableReferenceType::BASE_TABLE: {
+		auto &base_ref = ref.Cast<BaseTableRef>();
+		if (base_ref.catalog_name.empty() && base_ref.schema_name.empty() &&
+		    StringUtil::CIEquals(base_ref.table_name, name)) {
+			count++;
+		}
+		break;
+	}
+	case TableReferenceType::JOIN: {
+		auto &join_ref = ref.Cast<JoinRef>();
+		CountCTEReferences(*join_ref.left, name, count);
+		CountCTEReferences(*join_ref.right, name, count);
+		if (join_ref.condition) {
+			CountCTEReferences(*join_ref.condition, name, count);
+		}
+		break;
+	}
+	case TableReferenceType::SUBQUERY:
+		CountCTEReferences(*ref.Cast<SubqueryRef>().subquery->node, name, count);
+		break;
+	case TableReferenceType::PIVOT:
+		CountCTEReferences(*ref.Cast<PivotRef>().source, name, count);
+		break;
+	case TableReferenceType::TABLE_FUNCTION:
+		CountCTEReferences(*ref.Cast<TableFunctionRef>().function, name, count);
+		break;
+	case TableReferenceType::EXPRESSION_LIST:
+		for (auto &row : ref.Cast<ExpressionListRef>().values) {
+			for (auto &expr : row) {
+				CountCTEReferences(*expr, name, count);
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+//! Counts the (syntactic) references to the CTE with the given name in a query node
+static void CountCTEReferences(QueryNode &node, const string &name, idx_t &count) {
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE: {
+		auto &select = node.Cast<SelectNode>();
+		if (select.from_table) {
+			CountCTEReferences(*select.from_table, name, count);
+		}
+		for (auto &expr : select.select_list) {
+			CountCTEReferences(*expr, name, count);
+		}
+		for (auto &expr : select.groups.group_expressions) {
+			CountCTEReferences(*expr, name, count);
+		}
+		if (select.where_clause) {
+			CountCTEReferences(*select.where_clause, name, count);
+		}
+		if (select.having) {
+			CountCTEReferences(*select.having, name, count);
+		}
+		if (select.qualify) {
+			CountCTEReferences(*select.qualify, name, count);
+		}
+		break;
+	}
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &setop = node.Cast<SetOperationNode>();
+		CountCTEReferences(*setop.left, name, count);
+		CountCTEReferences(*setop.right, name, count);
+		break;
+	}
+	case QueryNodeType::RECURSIVE_CTE_NODE: {
+		auto &rec = node.Cast<RecursiveCTENode>();
+		CountCTEReferences(*rec.left, name, count);
+		CountCTEReferences(*rec.right, name, count);
+		break;
+	}
+	default:
+		break;
+	}
+	ParsedExpressionIterator::EnumerateQueryNodeModifiers(
+	    node, [&](unique_ptr<ParsedExpression> &child) { CountCTEReferences(*child, name, count); });
+	for (auto &kv : node.cte_map.map) {
+		if (StringUtil::CIEquals(kv.first, name)) {
+			// references in the definition of the CTE itself are recursive references
+			continue;
+		}
+		CountCTEReferences(*kv.second->query->node, name, count);
+	}
+}
+
+//! Whether or not the CTE is expensive enough that recomputing it for every reference should be avoided
+static bool IsExpensiveCTE(QueryNode &node) {
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE: {
+		auto &select = node.Cast<SelectNode>();
+		if (!select.groups.group_expressions.empty() ||
+		    select.aggregate_handling == AggregateHandling::FORCE_AGGREGATES) {
+			return true;
+		}
+		if (select.from_table && select.from_table->type == TableReferenceType::JOIN) {
+			return true;
+		}
+		for (auto &modifier : select.modifiers) {
+			if (modifier->type == ResultModifierType::DISTINCT_MODIFIER) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case QueryNodeType::SET_OPERATION_NODE:
+	case QueryNodeType::RECURSIVE_CTE_NODE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool ShouldMaterializeCTE(QueryNode &node, const string &name, CommonTableExpressionInfo &cte) {
+	if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_NEVER) {
+		return false;
+	}
+	idx_t reference_count = 0;
+	CountCTEReferences(node, name, reference_count);
+	if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_ALWAYS) {
+		return reference_count > 0;
+	}
+	// by default, only materialize expensive CTEs that are referenced more than once
+	return reference_count > 1 && IsExpensiveCTE(*cte.query->node);
+}
+
+vector<unique_ptr<BoundCTENode>> Binder::BindMaterializedCTEs(QueryNode &node) {
+	vector<unique_ptr<BoundCTENode>> result;
+
+	// gather the CTEs that should be materialized
+	vector<reference<const string>> candidates;
+	for (auto &kv : node.cte_map.map) {
+		if (ShouldMaterializeCTE(node, kv.first, *kv.second)) {
+			candidates.push_back(kv.first);
+		}
+	}
+	while (!candidates.empty()) {
+		// bind CTEs that are referenced by other candidates first, so those can scan the materialized result
+		idx_t next = 0;
+		for (idx_t i = 0; i < candidates.size(); i++) {
+			auto &query = *node.cte_map.map[candidates[i].get()]->query->node;
+			bool has_dependency = false;
+			for (idx_t j = 0; j < candidates.size() && !has_dependency; j++) {
+				idx_t reference_count = 0;
+				if (i != j) {
+					CountCTEReferences(query, candidates[j].get(), reference_count);
+				}
+				has_dependency = reference_count > 0;
+			}
+			if (!has_dependency) {
+				next = i;
+				break;
+			}
+		}
+		const auto &name = candidates[next].get();
+		candidates.erase(candidates.begin() + next);
+
+		auto &cte = *node.cte_map.map[name];
+		auto cte_binder = Binder::CreateBinder(context, this);
+		cte_binder->bound_ctes.insert(cte);
+		unique_ptr<BoundQueryNode> query;
+		try {
+			// binding replaces the parsed expressions, so bind a copy in case the CTE has to be inlined after all
+			auto cte_query = cte.query->node->Copy();
+			query = cte_binder->BindNode(*cte_query);
+		} catch (BinderException &) {
+			// the CTE can only be bound in the context of its references: inline it instead
+			continue;
+		}
+		if (!cte_binder->correlated_columns.empty()) {
+			// correlated CTEs are evaluated per reference: inline them instead
+			continue;
+		}
+
+		auto cte_node = make_uniq<BoundCTENode>();
+		cte_node->ctename = name;
+		cte_node->setop_index = GenerateTableIndex();
+		// names are picked from the CTE definition, unless aliases are explicitly specified
+		auto names = query->names;
+		for (idx_t i = 0; i < cte.aliases.size() && i < names.size(); i++) {
+			names[i] = cte.aliases[i];
+		}
+		bind_context.AddCTEBinding(cte_node->setop_index, name, names, query->types);
+
+		cte_node->query = std::move(query);
+		cte_node->query_binder = std::move(cte_binder);
+		result.push_back(std::move(cte_node));
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -7,6 +7,7 @@
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression_binder/order_binder.hpp"
+#include "duckdb/planner/query_node/bound_cte_node.hpp"
 #include "duckdb/planner/query_node/bound_select_node.hpp"
 #include "duckdb/planner/query_node/bound_set_operation_node.hpp"
 
@@ -38,6 +39,10 @@ static void GatherAliases(BoundQueryNode &node, case_insensitive_map_t<idx_t> &a
 
 		GatherAliases(*setop.left, aliases, expressions, reorder_idx);
 		GatherAliases(*setop.right, aliases, expressions, reorder_idx);
+	} else if (node.type == QueryNodeType::CTE_NODE) {
+		// materialized CTE, the aliases are defined by the query that references the CTE
+		auto &cte_node = node.Cast<BoundCTENode>();
+		GatherAliases(*cte_node.child, aliases, expressions, reorder_idx);
 	} else {
 		// query node
 		D_ASSERT(node.type == QueryNodeType::SELECT_NODE);
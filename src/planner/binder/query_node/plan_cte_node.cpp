@@ -0,0 +1,40 @@
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/operator/logical_cteref.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
+#include "duckdb/planner/query_node/bound_cte_node.hpp"
+
+namespace duckdb {
+
+//! Mark the references to the materialized CTE, and give them the cardinality estimate of the CTE
+static void MarkMaterializedCTEReferences(LogicalOperator &op, idx_t cte_index, idx_t cardinality) {
+	if (op.type == LogicalOperatorType::LOGICAL_CTE_REF) {
+		auto &cte_ref = op.Cast<LogicalCTERef>();
+		if (cte_ref.cte_index == cte_index) {
+			cte_ref.materialized_cte = true;
+			cte_ref.estimated_cardinality = cardinality;
+			cte_ref.has_estimated_cardinality = true;
+		}
+	}
+	for (auto &child : op.children) {
+		MarkMaterializedCTEReferences(*child, cte_index, cardinality);
+	}
+}
+
+unique_ptr<LogicalOperator> Binder::CreatePlan(BoundCTENode &node) {
+	// Generate the logical plan for the CTE definition and the query that references it
+	node.query_binder->plan_subquery = plan_subquery;
+
+	auto cte_query = node.query_binder->CreatePlan(*node.query);
+	auto cte_child = CreatePlan(*node.child);
+
+	// check if there are any unplanned subqueries left in either child
+	has_unplanned_subqueries = has_unplanned_subqueries || node.query_binder->has_unplanned_subqueries;
+
+	MarkMaterializedCTEReferences(*cte_child, node.setop_index, cte_query->EstimateCardinality(context));
+
+	auto root = make_uniq<LogicalMaterializedCTE>(node.ctename, node.setop_index, node.query->types.size(),
+	                                              std::move(cte_query), std::move(cte_child));
+	return VisitQueryNode(node, std::move(root));
+}
+
+} // namespace duckdb
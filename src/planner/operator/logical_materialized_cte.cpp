@@ -0,0 +1,30 @@
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
+
+#include "duckdb/common/field_writer.hpp"
+
+namespace duckdb {
+
+string LogicalMaterializedCTE::ParamsToString() const {
+	return ctename;
+}
+
+void LogicalMaterializedCTE::Serialize(FieldWriter &writer) const {
+	writer.WriteField(table_index);
+	writer.WriteField(column_count);
+	writer.WriteString(ctename);
+}
+
+unique_ptr<LogicalOperator> LogicalMaterializedCTE::Deserialize(LogicalDeserializationState &state,
+                                                                FieldReader &reader) {
+	auto result = unique_ptr<LogicalMaterializedCTE>(new LogicalMaterializedCTE());
+	result->table_index = reader.ReadRequired<idx_t>();
+	result->column_count = reader.ReadRequired<idx_t>();
+	result->ctename = reader.ReadRequired<string>();
+	return std::move(result);
+}
+
+vector<idx_t> LogicalMaterializedCTE::GetTableIndex() const {
+	return vector<idx_t> {table_index};
+}
+
+} // namespace duckdb
@@ -526,6 +526,11 @@ unique_ptr<LogicalOperator> FlattenDependentJoins::PushDownDependentJoinInternal
 		this->data_offset = 0;
 		return plan;
 	}
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
+		// materialized CTEs are never correlated: only the query that references the CTE can be correlated
+		plan->children[1] = PushDownDependentJoin(std::move(plan->children[1]));
+		return plan;
+	}
 	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE: {
 		throw BinderException("Recursive CTEs not supported in correlated subquery");
 	}
@@ -0,0 +1,95 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "http_disk_cache.hpp"
+
+#include <utime.h>
+
+using namespace duckdb;
+
+static void WriteTestFile(FileSystem &fs, const string &path, time_t last_modified) {
+	{
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		fs.Write(*handle, (void *)"partial", 7, 0);
+	}
+	struct utimbuf times;
+	times.actime = last_modified;
+	times.modtime = last_modified;
+	REQUIRE(utime(path.c_str(), &times) == 0);
+}
+
+TEST_CASE("Test reading and writing blocks of the HTTP disk cache", "[extension]") {
+	auto fs = FileSystem::CreateLocal();
+	auto cache_dir = TestCreatePath("http_disk_cache");
+	if (fs->DirectoryExists(cache_dir)) {
+		fs->RemoveDirectory(cache_dir);
+	}
+
+	// remote files of which the version is unknown are not cached
+	REQUIRE(HTTPDiskCache::GetFileKey("http://host/file", "", 0, 100).empty());
+	auto key = HTTPDiskCache::GetFileKey("http://host/file", "\"etag\"", 0, 100);
+	auto changed_key = HTTPDiskCache::GetFileKey("http://host/file", "\"etag2\"", 0, 100);
+	REQUIRE(!key.empty());
+	REQUIRE(key != changed_key);
+
+	vector<data_t> block(1000);
+	for (idx_t i = 0; i < block.size(); i++) {
+		block[i] = i % 251;
+	}
+	vector<data_t> buffer(block.size());
+	{
+		HTTPDiskCache cache(cache_dir, 100000);
+		REQUIRE(!cache.Contains(key, 0));
+		REQUIRE(!cache.ReadBlock(key, 0, buffer.data(), buffer.size()));
+
+		cache.WriteBlock(key, 0, block.data(), block.size());
+		REQUIRE(cache.Contains(key, 0));
+		REQUIRE(cache.ReadBlock(key, 0, buffer.data(), buffer.size()));
+		REQUIRE(buffer == block);
+
+		// a different version of the file, block or length is a cache miss
+		REQUIRE(!cache.ReadBlock(changed_key, 0, buffer.data(), buffer.size()));
+		REQUIRE(!cache.ReadBlock(key, 1, buffer.data(), buffer.size()));
+		REQUIRE(!cache.ReadBlock(key, 0, buffer.data(), buffer.size() - 1));
+	}
+	{
+		// the blocks cached by an earlier instance are picked up
+		HTTPDiskCache cache(cache_dir, 100000);
+		std::fill(buffer.begin(), buffer.end(), 0);
+		REQUIRE(cache.ReadBlock(key, 0, buffer.data(), buffer.size()));
+		REQUIRE(buffer == block);
+
+		// the least recently used blocks are evicted once the cache is full
+		cache.SetMaxSize(3 * (sizeof(uint32_t) + key.size() + block.size()));
+		cache.WriteBlock(key, 1, block.data(), block.size());
+		cache.WriteBlock(key, 2, block.data(), block.size());
+		REQUIRE(cache.ReadBlock(key, 0, buffer.data(), buffer.size()));
+		cache.WriteBlock(key, 3, block.data(), block.size());
+		REQUIRE(cache.Contains(key, 0));
+		REQUIRE(!cache.Contains(key, 1));
+		REQUIRE(cache.Contains(key, 2));
+		REQUIRE(cache.Contains(key, 3));
+	}
+	fs->RemoveDirectory(cache_dir);
+}
+
+TEST_CASE("Test that the HTTP disk cache only removes stale temporary files", "[extension]") {
+	auto fs = FileSystem::CreateLocal();
+	auto cache_dir = TestCreatePath("http_disk_cache_temp");
+	if (fs->DirectoryExists(cache_dir)) {
+		fs->RemoveDirectory(cache_dir);
+	}
+	fs->CreateDirectory(cache_dir);
+
+	// a write that was abandoned long ago, and a write that may still be in progress in another process
+	auto now = time(nullptr);
+	auto stale_path = fs->JoinPath(cache_dir, "1_0.block.0.tmp");
+	auto recent_path = fs->JoinPath(cache_dir, "2_0.block.0.tmp");
+	WriteTestFile(*fs, stale_path, now - HTTPDiskCache::STALE_TEMP_FILE_AGE - 60);
+	WriteTestFile(*fs, recent_path, now);
+
+	HTTPDiskCache cache(cache_dir, 100000);
+	REQUIRE(!fs->FileExists(stale_path));
+	REQUIRE(fs->FileExists(recent_path));
+
+	fs->RemoveDirectory(cache_dir);
+}
@@ -56,6 +56,7 @@
 	PGSubLinkType subquerytype;
 	PGViewCheckOption viewcheckoption;
 	PGInsertColumnOrder bynameorposition;
+	PGCTEMaterialize			ctematerialize;
 }
 
 %type <node> stmt
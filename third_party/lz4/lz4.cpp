@@ -0,0 +1,226 @@
+#include "lz4.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace duckdb_lz4 {
+
+namespace {
+
+//! Matches are at least this long
+constexpr int MIN_MATCH = 4;
+//! The last match must start at least this many bytes before the end of the block
+constexpr int MFLIMIT = 12;
+//! The last bytes of a block are always literals
+constexpr int LAST_LITERALS = 5;
+//! Inputs shorter than this are stored as literals
+constexpr int MIN_LENGTH = MFLIMIT + 1;
+//! The maximum distance between a match and the current position
+constexpr int MAX_DISTANCE = 65535;
+//! Lengths of this size are continued in additional bytes
+constexpr unsigned RUN_MASK = 15;
+constexpr unsigned ML_MASK = 15;
+//! The hash table that is used to find matches has 2^HASH_LOG entries
+constexpr int HASH_LOG = 12;
+//! After this many failed attempts to find a match we start skipping bytes (log2)
+constexpr int SKIP_TRIGGER = 6;
+
+uint32_t Read32(const uint8_t *ptr) {
+	uint32_t result;
+	memcpy(&result, ptr, sizeof(uint32_t));
+	return result;
+}
+
+uint32_t Hash(uint32_t sequence) {
+	return (sequence * 2654435761U) >> (32 - HASH_LOG);
+}
+
+//! Writes the remainder of a length that did not fit in the token
+uint8_t *WriteLength(uint8_t *op, unsigned length) {
+	while (length >= 255) {
+		*op++ = 255;
+		length -= 255;
+	}
+	*op++ = uint8_t(length);
+	return op;
+}
+
+//! Writes a sequence of literals followed by a match (if match_length != 0). Returns nullptr if it does not fit.
+uint8_t *WriteSequence(uint8_t *op, uint8_t *oend, const uint8_t *literals, unsigned literal_length, unsigned offset,
+                       unsigned match_length) {
+	// token + literal length + literals + offset + match length
+	size_t max_size = 1 + literal_length / 255 + 1 + literal_length + 2 + match_length / 255 + 1;
+	if (max_size > size_t(oend - op)) {
+		return nullptr;
+	}
+	auto token = op++;
+	if (literal_length >= RUN_MASK) {
+		*token = RUN_MASK << 4;
+		op = WriteLength(op, literal_length - RUN_MASK);
+	} else {
+		*token = uint8_t(literal_length << 4);
+	}
+	if (literal_length > 0) {
+		memcpy(op, literals, literal_length);
+		op += literal_length;
+	}
+	if (match_length == 0) {
+		return op;
+	}
+	*op++ = uint8_t(offset);
+	*op++ = uint8_t(offset >> 8);
+	match_length -= MIN_MATCH;
+	if (match_length >= ML_MASK) {
+		*token |= ML_MASK;
+		op = WriteLength(op, match_length - ML_MASK);
+	} else {
+		*token |= uint8_t(match_length);
+	}
+	return op;
+}
+
+//! Reads the remainder of a length that did not fit in the token. Returns false if the input ends prematurely.
+bool ReadLength(const uint8_t *&ip, const uint8_t *iend, size_t &length) {
+	uint8_t byte;
+	do {
+		if (ip >= iend) {
+			return false;
+		}
+		byte = *ip++;
+		length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+} // namespace
+
+int LZ4_compressBound(int inputSize) {
+	return LZ4_COMPRESSBOUND(inputSize);
+}
+
+int LZ4_compress_default(const char *src, char *dst, int srcSize, int dstCapacity) {
+	if (srcSize < 0 || srcSize > LZ4_MAX_INPUT_SIZE || dstCapacity <= 0) {
+		return 0;
+	}
+	auto base = reinterpret_cast<const uint8_t *>(src);
+	auto ip = base;
+	auto anchor = base;
+	auto iend = base + srcSize;
+	auto op = reinterpret_cast<uint8_t *>(dst);
+	auto oend = op + dstCapacity;
+
+	if (srcSize >= MIN_LENGTH) {
+		auto mflimit = iend - MFLIMIT;
+		auto matchlimit = iend - LAST_LITERALS;
+		// the positions of previously seen 4-byte sequences, relative to the start of the input
+		uint32_t hash_table[1 << HASH_LOG];
+		memset(hash_table, 0, sizeof(hash_table));
+
+		unsigned search_count = 1 << SKIP_TRIGGER;
+		ip++;
+		while (ip <= mflimit) {
+			auto sequence = Read32(ip);
+			auto hash = Hash(sequence);
+			auto ref = base + hash_table[hash];
+			hash_table[hash] = uint32_t(ip - base);
+			if (ref >= ip || ip - ref > MAX_DISTANCE || Read32(ref) != sequence) {
+				// no match: skip ahead faster the longer we do not find one
+				ip += search_count++ >> SKIP_TRIGGER;
+				continue;
+			}
+			// extend the match backwards over the pending literals
+			while (ip > anchor && ref > base && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+			}
+			// extend the match forwards
+			auto match_end = ip + MIN_MATCH;
+			auto ref_end = ref + MIN_MATCH;
+			while (match_end < matchlimit && *match_end == *ref_end) {
+				match_end++;
+				ref_end++;
+			}
+			op = WriteSequence(op, oend, anchor, unsigned(ip - anchor), unsigned(ip - ref), unsigned(match_end - ip));
+			if (!op) {
+				return 0;
+			}
+			ip = match_end;
+			anchor = ip;
+			search_count = 1 << SKIP_TRIGGER;
+			if (ip <= mflimit) {
+				// fill in a position inside the match so the next sequence can reference it
+				hash_table[Hash(Read32(ip - 2))] = uint32_t(ip - 2 - base);
+			}
+		}
+	}
+	// the remaining bytes are written as literals
+	op = WriteSequence(op, oend, anchor, unsigned(iend - anchor), 0, 0);
+	if (!op) {
+		return 0;
+	}
+	return int(op - reinterpret_cast<uint8_t *>(dst));
+}
+
+int LZ4_decompress_safe(const char *src, char *dst, int compressedSize, int dstCapacity) {
+	if (compressedSize <= 0 || dstCapacity < 0) {
+		return -1;
+	}
+	auto ip = reinterpret_cast<const uint8_t *>(src);
+	auto iend = ip + compressedSize;
+	auto ostart = reinterpret_cast<uint8_t *>(dst);
+	auto op = ostart;
+	auto oend = op + dstCapacity;
+	while (true) {
+		if (ip >= iend) {
+			return -1;
+		}
+		unsigned token = *ip++;
+
+		// copy the literals
+		size_t literal_length = token >> 4;
+		if (literal_length == RUN_MASK && !ReadLength(ip, iend, literal_length)) {
+			return -1;
+		}
+		if (literal_length > size_t(iend - ip) || literal_length > size_t(oend - op)) {
+			return -1;
+		}
+		memcpy(op, ip, literal_length);
+		ip += literal_length;
+		op += literal_length;
+		if (ip == iend) {
+			// the last sequence only has literals
+			break;
+		}
+
+		// copy the match
+		if (iend - ip < 2) {
+			return -1;
+		}
+		size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+		ip += 2;
+		if (offset == 0 || offset > size_t(op - ostart)) {
+			return -1;
+		}
+		size_t match_length = token & ML_MASK;
+		if (match_length == ML_MASK && !ReadLength(ip, iend, match_length)) {
+			return -1;
+		}
+		match_length += MIN_MATCH;
+		if (match_length > size_t(oend - op)) {
+			return -1;
+		}
+		auto match = op - offset;
+		if (offset >= match_length) {
+			memcpy(op, match, match_length);
+			op += match_length;
+		} else {
+			// the match overlaps with the output, which repeats the last offset bytes
+			for (size_t i = 0; i < match_length; i++) {
+				*op++ = *match++;
+			}
+		}
+	}
+	return int(op - ostart);
+}
+
+} // namespace duckdb_lz4
@@ -0,0 +1,33 @@
+/*
+ * LZ4 block format codec.
+ *
+ * This is a compact implementation of the LZ4 block format
+ * (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md) that exposes the subset of the LZ4 API that is used
+ * by DuckDB. The functions have the same semantics as their upstream counterparts, so compressed blocks are
+ * interchangeable with the reference implementation, and this file can be replaced by the upstream lz4.c/lz4.h
+ * (BSD 2-Clause) without changes to its callers. The Parquet tests read pages written by the reference
+ * implementation (data/parquet-testing/compression/generated/lz4_raw_patterns.parquet).
+ */
+
+#pragma once
+
+namespace duckdb_lz4 {
+
+//! The maximum input size that can be compressed
+#define LZ4_MAX_INPUT_SIZE 0x7E000000
+//! The maximum compressed size of an input of the given size
+#define LZ4_COMPRESSBOUND(isize)                                                                                       \
+	((unsigned)(isize) > (unsigned)LZ4_MAX_INPUT_SIZE ? 0 : (isize) + ((isize) / 255) + 16)
+
+//! Returns the maximum size of the compressed output of an input of the given size, or 0 if the input is too large
+int LZ4_compressBound(int inputSize);
+
+//! Compresses srcSize bytes from src into dst, which has dstCapacity bytes available. Returns the number of bytes
+//! written to dst, or 0 if compression fails (e.g. because the output does not fit in dst).
+int LZ4_compress_default(const char *src, char *dst, int srcSize, int dstCapacity);
+
+//! Decompresses compressedSize bytes from src into dst, which has dstCapacity bytes available. Returns the number of
+//! bytes written to dst, or a negative value if the input is malformed. Never reads or writes outside the buffers.
+int LZ4_decompress_safe(const char *src, char *dst, int compressedSize, int dstCapacity);
+
+} // namespace duckdb_lz4